@@ -60,6 +60,15 @@
     #include <vtkh/vtkh.hpp>
 #endif
 
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+
+#ifdef PARALLEL
+#include <mpi.h>
+#endif
+
 using namespace conduit;
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
@@ -75,16 +84,261 @@ quiet_handler(const std::string &,
 {
 }
 
+//-----------------------------------------------------------------------------
+//
+// Runs publish + execute of the runtime on a background thread, so the
+// caller can continue while the previous cycle is visualized.
+//
+// publish() copies the data into the back buffer of an ascent-owned 
+// double buffer (reusing its memory when the data layout is unchanged).
+// execute() swaps the buffers and hands the actions to the background 
+// thread. If the previous execute has not finished, execute() either 
+// waits for it ("wait" policy) or drops the new cycle ("skip" policy).
+//
+//-----------------------------------------------------------------------------
+class Ascent::AsyncPipeline
+{
+public:
+    AsyncPipeline(Runtime *runtime,
+                  const std::string &policy);
+    ~AsyncPipeline();
+
+    void publish(const conduit::Node &data);
+    void execute(const conduit::Node &actions);
+    void wait();
+    void info(conduit::Node &out);
+
+private:
+    void worker();
+    // rethrows (and clears) an error raised by the background thread,
+    // must be called with m_mutex held
+    void check_error();
+
+    Runtime                 *m_runtime;
+    bool                     m_skip_when_busy;
+
+    conduit::Node            m_buffers[2];
+    // buffer publish() writes to, the other one is used by the runtime
+    int                      m_back;
+    bool                     m_published;
+
+    // the next execute, handed to the background thread
+    conduit::Node            m_actions;
+    bool                     m_pending;
+    bool                     m_pending_publish;
+    bool                     m_busy;
+    bool                     m_stop;
+
+    index_t                  m_num_executed;
+    index_t                  m_num_skipped;
+
+    std::exception_ptr       m_error;
+    std::mutex               m_mutex;
+    std::condition_variable  m_cond;
+    std::thread              m_thread;
+};
+
+//-----------------------------------------------------------------------------
+Ascent::AsyncPipeline::AsyncPipeline(Runtime *runtime,
+                                     const std::string &policy)
+: m_runtime(runtime),
+  m_skip_when_busy(false),
+  m_back(0),
+  m_published(false),
+  m_pending(false),
+  m_pending_publish(false),
+  m_busy(false),
+  m_stop(false),
+  m_num_executed(0),
+  m_num_skipped(0)
+{
+    if(policy == "skip")
+    {
+        m_skip_when_busy = true;
+    }
+    else if(policy != "wait")
+    {
+        ASCENT_ERROR("Unsupported async policy \"" << policy << "\""
+                     " (expected \"wait\" or \"skip\")");
+    }
+
+    m_thread = std::thread(&AsyncPipeline::worker,this);
+}
+
+//-----------------------------------------------------------------------------
+Ascent::AsyncPipeline::~AsyncPipeline()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cond.notify_all();
+    // the worker finishes any pending execute before it exits
+    m_thread.join();
+
+    if(m_error)
+    {
+        ASCENT_WARN("Discarding error from an asynchronous execute");
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Ascent::AsyncPipeline::publish(const conduit::Node &data)
+{
+    // the runtime only reads the other buffer, so no need to lock
+    Node &buffer = m_buffers[m_back];
+
+    if(buffer.compatible(data) && data.compatible(buffer))
+    {
+        buffer.update_compatible(data);
+    }
+    else
+    {
+        buffer.set(data);
+    }
+
+    m_published = true;
+}
+
+//-----------------------------------------------------------------------------
+void
+Ascent::AsyncPipeline::execute(const conduit::Node &actions)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    check_error();
+
+    if(m_busy || m_pending)
+    {
+        if(m_skip_when_busy)
+        {
+            m_num_skipped++;
+            ASCENT_INFO("Previous execute is still running, skipping");
+            return;
+        }
+
+        while(m_busy || m_pending)
+        {
+            m_cond.wait(lock);
+        }
+        check_error();
+    }
+
+    // the runtime is idle, the back buffer becomes the published data
+    if(m_published)
+    {
+        m_back = 1 - m_back;
+        m_published = false;
+        m_pending_publish = true;
+    }
+
+    m_actions.set(actions);
+    m_pending = true;
+
+    lock.unlock();
+    m_cond.notify_all();
+}
+
+//-----------------------------------------------------------------------------
+void
+Ascent::AsyncPipeline::wait()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while(m_busy || m_pending)
+    {
+        m_cond.wait(lock);
+    }
+    check_error();
+}
+
+//-----------------------------------------------------------------------------
+void
+Ascent::AsyncPipeline::info(conduit::Node &out)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    out["policy"]   = m_skip_when_busy ? "skip" : "wait";
+    out["executed"] = m_num_executed;
+    out["skipped"]  = m_num_skipped;
+}
+
+//-----------------------------------------------------------------------------
+void
+Ascent::AsyncPipeline::check_error()
+{
+    if(m_error)
+    {
+        std::exception_ptr error = m_error;
+        m_error = std::exception_ptr();
+        std::rethrow_exception(error);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Ascent::AsyncPipeline::worker()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while(true)
+    {
+        while(!m_pending && !m_stop)
+        {
+            m_cond.wait(lock);
+        }
+
+        if(!m_pending)
+        {
+            return;
+        }
+
+        bool publish = m_pending_publish;
+        Node &data   = m_buffers[1 - m_back];
+
+        m_pending = false;
+        m_pending_publish = false;
+        m_busy = true;
+        lock.unlock();
+
+        std::exception_ptr error;
+        try
+        {
+            if(publish)
+            {
+                m_runtime->Publish(data);
+            }
+            m_runtime->Execute(m_actions);
+        }
+        catch(...)
+        {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        if(error && !m_error)
+        {
+            m_error = error;
+        }
+        m_busy = false;
+        m_num_executed++;
+        m_cond.notify_all();
+    }
+}
+
 //-----------------------------------------------------------------------------
 Ascent::Ascent()
-: m_runtime(NULL)
+: m_runtime(NULL),
+  m_async(NULL)
 {
 }
 
 //-----------------------------------------------------------------------------
 Ascent::~Ascent()
 {
-
+    // don't leave the background thread running
+    if(m_async != NULL)
+    {
+        delete m_async;
+        m_async = NULL;
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -120,16 +374,28 @@ Ascent::open(const conduit::Node &options)
         ASCENT_ERROR("Ascent Runtime already exists.!");
     }
 
-    bool quiet_output = true; 
+    // ascent_info selects what is logged:
+    //   "quiet" (default): warnings and errors
+    //   "info": basic progress messages
+    //   "verbose": detailed diagnostics (graphs, registry state, etc)
+    // disabled messages are never constructed
+    int log_level = flow::logging::LEVEL_WARN;
     if(options.has_path("ascent_info"))
     {
-        if(options["ascent_info"].as_string() == "verbose")
+        std::string ascent_info = options["ascent_info"].as_string();
+        if(ascent_info == "verbose")
         {
-            quiet_output = false;
+            log_level = flow::logging::LEVEL_DEBUG;
+        }
+        else if(ascent_info == "info")
+        {
+            log_level = flow::logging::LEVEL_INFO;
         }
     }
 
-    if(quiet_output)
+    flow::logging::set_level(log_level);
+
+    if(log_level == flow::logging::LEVEL_WARN)
     {
         conduit::utils::set_info_handler(quiet_handler);
     }
@@ -194,13 +460,49 @@ Ascent::open(const conduit::Node &options)
     }
      
     m_runtime->Initialize(processed_opts);
+
+    // optionally overlap publish + execute with the caller
+    if(processed_opts.has_path("async/enabled") &&
+       processed_opts["async/enabled"].as_string() == "true")
+    {
+        std::string policy = "wait";
+        if(processed_opts.has_path("async/policy"))
+        {
+            policy = processed_opts["async/policy"].as_string();
+        }
+
+        bool async_ok = true;
+#ifdef PARALLEL
+        // the background thread issues mpi calls while the caller
+        // may do the same
+        int thread_level = MPI_THREAD_SINGLE;
+        MPI_Query_thread(&thread_level);
+        if(thread_level < MPI_THREAD_MULTIPLE)
+        {
+            ASCENT_WARN("Asynchronous execute requires MPI to be initialized"
+                        " with MPI_THREAD_MULTIPLE, using synchronous execute");
+            async_ok = false;
+        }
+#endif
+        if(async_ok)
+        {
+            m_async = new AsyncPipeline(m_runtime, policy);
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
 void
 Ascent::publish(const conduit::Node &data)
 {
-    m_runtime->Publish(data);
+    if(m_async != NULL)
+    {
+        m_async->publish(data);
+    }
+    else
+    {
+        m_runtime->Publish(data);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -209,13 +511,57 @@ Ascent::execute(const conduit::Node &actions)
 {
     Node processed_actions(actions);
     CheckForJSONFile("ascent_actions.json", processed_actions);
-    m_runtime->Execute(processed_actions);
+
+    if(m_async != NULL)
+    {
+        m_async->execute(processed_actions);
+    }
+    else
+    {
+        m_runtime->Execute(processed_actions);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Ascent::wait()
+{
+    if(m_async != NULL)
+    {
+        m_async->wait();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Ascent::info(conduit::Node &out)
+{
+    out.reset();
+    if(m_runtime != NULL)
+    {
+        // the runtime can't be queried while it executes
+        wait();
+        m_runtime->Info(out);
+    }
+
+    if(m_async != NULL)
+    {
+        m_async->info(out["async"]);
+    }
 }
 
 //-----------------------------------------------------------------------------
 void
 Ascent::close()
 {
+    if(m_async != NULL)
+    {
+        // finishes pending executes
+        AsyncPipeline *async = m_async;
+        m_async = NULL;
+        delete async;
+    }
+
     if(m_runtime != NULL)
     {
         m_runtime->Cleanup();
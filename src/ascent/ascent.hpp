@@ -87,11 +87,19 @@ public:
     void   open(const conduit::Node &options);
     void   publish(const conduit::Node &data);
     void   execute(const conduit::Node &actions);
+    // blocks until pending asynchronous executes are finished
+    // (see the "async" open options), a no-op otherwise
+    void   wait();
+    // fills out with info about the runtime (e.g. cache hits and misses)
+    void   info(conduit::Node &out);
     void   close();
 
 private:
+
+    class AsyncPipeline;
     
-    Runtime *m_runtime;
+    Runtime       *m_runtime;
+    AsyncPipeline *m_async;
 };
 
 
@@ -69,6 +69,13 @@ Runtime::~Runtime()
 
 }
 
+//-----------------------------------------------------------------------------
+void
+Runtime::Info(conduit::Node &out)
+{
+    out.reset();
+}
+
 //-----------------------------------------------------------------------------
 };
 //-----------------------------------------------------------------------------
@@ -72,6 +72,9 @@ public:
 
     virtual void  Publish(const conduit::Node &data)=0;
     virtual void  Execute(const conduit::Node &actions)=0;
+
+    // optionally override to provide info about the runtime
+    virtual void  Info(conduit::Node &out);
     
     virtual void  Cleanup()=0;
 };
@@ -88,6 +88,10 @@ void ascent_publish(Ascent *sman, conduit_node *data);
 
 void ascent_execute(Ascent *sman, conduit_node *actions);
 
+void ascent_wait(Ascent *sman);
+
+void ascent_info(Ascent *sman, conduit_node *out);
+
 void ascent_close(Ascent *sman);
 
 
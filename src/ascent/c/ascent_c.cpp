@@ -124,6 +124,24 @@ ascent_execute(Ascent *c_sman,
     v->execute(*n);
 }
 
+//---------------------------------------------------------------------------//
+void
+ascent_wait(Ascent *c_sman)
+{
+    ascent::Ascent *v = cpp_ascent(c_sman);
+    v->wait();
+}
+
+//---------------------------------------------------------------------------//
+void
+ascent_info(Ascent *c_sman,
+            conduit_node *c_out)
+{
+    ascent::Ascent *v = cpp_ascent(c_sman);
+    Node  *n = static_cast<Node*>(c_out);
+    v->info(*n);
+}
+
 //---------------------------------------------------------------------------//
 void
 ascent_close(Ascent *c_sman)
@@ -156,6 +174,12 @@ void ascent_timer_write()
 {
   ascent::BlockTimer::WriteLogFile(); 
 }
+
+//---------------------------------------------------------------------------//
+void ascent_timer_trace(char *file_name)
+{
+  ascent::BlockTimer::EnableTrace(file_name); 
+}
 }
 //-----------------------------------------------------------------------------
 // -- end extern C
@@ -109,6 +109,14 @@ module ascent
         type(C_PTR), value, intent(IN) ::cnode
     end subroutine ascent_execute
  
+    !--------------------------------------------------------------------------
+    subroutine ascent_wait(csman) &
+            bind(C, name="ascent_wait")
+        use iso_c_binding
+        implicit none
+        type(C_PTR), value, intent(IN) ::csman
+    end subroutine ascent_wait
+ 
     !--------------------------------------------------------------------------
     subroutine ascent_close(csman) &
             bind(C, name="ascent_close")
@@ -139,6 +147,13 @@ module ascent
         implicit none
     end subroutine ascent_timer_write
     !--------------------------------------------------------------------------
+    subroutine ascent_timer_trace(file_name) &
+            bind(C, name="ascent_timer_trace")
+        use iso_c_binding
+        implicit none
+        character(kind=c_char) :: file_name(*)
+    end subroutine ascent_timer_trace
+    !--------------------------------------------------------------------------
     end interface
     !--------------------------------------------------------------------------
 
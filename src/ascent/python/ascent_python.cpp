@@ -179,6 +179,8 @@ PyInt_AsLong(PyObject *o)
     // void   open(conduit::Node &options);
     // void   publish(conduit::Node &data);
     // void   execute(conduit::Node &actions);
+    // void   wait();
+    // void   info(conduit::Node &out);
     // void   close();
 
 
@@ -350,6 +352,50 @@ PyAscent_Ascent_execute(PyAscent_Ascent *self,
     Py_RETURN_NONE; 
 }
 
+//-----------------------------------------------------------------------------
+static PyObject *
+PyAscent_Ascent_wait(PyAscent_Ascent *self)
+{
+    self->ascent->wait();
+    Py_RETURN_NONE;
+}
+
+//-----------------------------------------------------------------------------
+static PyObject *
+PyAscent_Ascent_info(PyAscent_Ascent *self,
+                     PyObject *args,
+                     PyObject *kwargs)
+{
+
+    static const char *kwlist[] = {"out",
+                                    NULL};
+
+     PyObject *py_node = NULL;
+
+    if (!PyArg_ParseTupleAndKeywords(args,
+                                     kwargs,
+                                     "O",
+                                     const_cast<char**>(kwlist),
+                                     &py_node))
+    {
+        return NULL;
+    }
+    
+     
+    if(!PyConduit_Node_Check(py_node))
+    {
+        PyErr_SetString(PyExc_TypeError,
+                        "Ascent::Info 'out' argument must be a "
+                        "conduit::Node");
+        return NULL;
+    }
+    
+    Node *node = PyConduit_Node_Get_Node_Ptr(py_node);
+    self->ascent->info(*node);
+
+    Py_RETURN_NONE; 
+}
+
 //---------------------------------------------------------------------------//
 static PyObject *
 PyAscent_Ascent_close(PyAscent_Ascent *self)
@@ -385,6 +431,16 @@ static PyMethodDef PyAscent_Ascent_METHODS[] = {
      METH_VARARGS | METH_KEYWORDS,
       "{todo}"},
     //-----------------------------------------------------------------------//
+    {"wait",
+     (PyCFunction)PyAscent_Ascent_wait,
+     METH_NOARGS,
+     "{todo}"},
+    //-----------------------------------------------------------------------//
+    {"info",
+     (PyCFunction)PyAscent_Ascent_info,
+     METH_VARARGS | METH_KEYWORDS,
+     "{todo}"},
+    //-----------------------------------------------------------------------//
     {"close",
      (PyCFunction)PyAscent_Ascent_close, 
      METH_NOARGS,
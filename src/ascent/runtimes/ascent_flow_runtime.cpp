@@ -126,6 +126,30 @@ FlowRuntime::Initialize(const conduit::Node &options)
 #endif
 
     m_runtime_options = options;
+
+    // optionally execute independent filters concurrently
+    if(options.has_path("runtime/threads"))
+    {
+        w.set_number_of_threads(options["runtime/threads"].to_int());
+    }
+
+    // optionally limit the bytes of filter outputs kept across cycles
+    if(options.has_path("runtime/cache/max_bytes"))
+    {
+        w.cache().set_max_bytes(options["runtime/cache/max_bytes"].to_index_t());
+    }
+
+    // optionally order filters to reduce the peak memory of their outputs
+    if(options.has_path("runtime/ordering"))
+    {
+        w.set_ordering(options["runtime/ordering"].as_string());
+    }
+
+    // optionally merge filters with the same type, params and inputs
+    if(options.has_path("runtime/merge_filters"))
+    {
+        w.set_merge_filters(options["runtime/merge_filters"].as_string() == "true");
+    }
     
     // standard flow filters
     flow::filters::register_builtin();
@@ -134,6 +158,21 @@ FlowRuntime::Initialize(const conduit::Node &options)
 }
 
 
+//-----------------------------------------------------------------------------
+void
+FlowRuntime::Info(conduit::Node &out)
+{
+    out.reset();
+    out["runtime/type"] = "flow";
+    w.cache().info(out["runtime/cache"]);
+    w.memory_info(out["runtime/memory"]);
+
+    if(w.merge_filters())
+    {
+        w.merged_filters(out["runtime/merged_filters"]);
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 FlowRuntime::Cleanup()
@@ -79,6 +79,7 @@ public:
 
     void  Publish(const conduit::Node &data);
     void  Execute(const conduit::Node &actions);
+    void  Info(conduit::Node &out);
     
     void  Cleanup();
 
@@ -53,6 +53,9 @@
 
 // standard lib includes
 #include <string.h>
+#include <functional>
+#include <set>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 // thirdparty includes
@@ -97,7 +100,13 @@ namespace ascent
 
 //-----------------------------------------------------------------------------
 AscentRuntime::AscentRuntime()
-:Runtime()
+:Runtime(),
+ m_persistent(false),
+ m_graph_compiled(false),
+ m_ensure_vtkh(NULL),
+ m_actions_hash(0),
+ m_publish_count(0),
+ m_profile_dir(".")
 {
     flow::filters::register_builtin();
 }
@@ -171,6 +180,51 @@ AscentRuntime::Initialize(const conduit::Node &options)
 #endif
 
     m_runtime_options = options;
+
+    // optionally execute independent filters concurrently
+    if(options.has_path("runtime/threads"))
+    {
+        w.set_number_of_threads(options["runtime/threads"].to_int());
+    }
+
+    // optionally profile each execute, writing a json file per cycle
+    if(options.has_path("runtime/profiling/enabled"))
+    {
+        w.set_profiling(options["runtime/profiling/enabled"].as_string() == "true");
+    }
+
+    if(options.has_path("runtime/profiling/output_dir"))
+    {
+        m_profile_dir = options["runtime/profiling/output_dir"].as_string();
+    }
+
+    // optionally limit the bytes of filter outputs kept across cycles
+    if(options.has_path("runtime/cache/max_bytes"))
+    {
+        w.cache().set_max_bytes(options["runtime/cache/max_bytes"].to_index_t());
+    }
+
+    // optionally order filters to reduce the peak memory of their outputs
+    if(options.has_path("runtime/ordering"))
+    {
+        w.set_ordering(options["runtime/ordering"].as_string());
+    }
+
+    // optionally merge filters with the same type, params and inputs 
+    // (e.g. the bounds and domain ids of plots that share a pipeline).
+    // merged filters are removed from the graph, so this is opt-in: 
+    // actions that later connect to a merged filter's name will fail
+    if(options.has_path("runtime/merge_filters"))
+    {
+        w.set_merge_filters(options["runtime/merge_filters"].as_string() == "true");
+    }
+
+    // optionally keep the graph when the same actions are 
+    // executed each cycle
+    if(options.has_path("runtime/persistent"))
+    {
+        m_persistent = options["runtime/persistent"].as_string() == "true";
+    }
     
     // standard flow filters
     flow::filters::register_builtin();
@@ -179,6 +233,22 @@ AscentRuntime::Initialize(const conduit::Node &options)
 }
 
 
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::Info(conduit::Node &out)
+{
+    out.reset();
+    out["runtime/type"] = "ascent";
+    w.cache().info(out["runtime/cache"]);
+    w.memory_info(out["runtime/memory"]);
+    w.merged_filters(out["runtime/merged_filters"]);
+
+    if(w.profiling())
+    {
+        w.profile(out["runtime/profile"]);
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 AscentRuntime::Cleanup()
@@ -193,6 +263,157 @@ AscentRuntime::Publish(const conduit::Node &data)
     // create our own tree, with all data zero copied.
     m_data.set_external(data);
     
+    UpdateGenerations(data);
+    ConnectSource();
+}
+
+//-----------------------------------------------------------------------------
+// 
+// Tracks which parts of the published data changed since the last publish,
+// so cacheable filters that only read unchanged parts can reuse their 
+// outputs. Simulations can list what changed in "state/changed":
+//
+//   state/changed/fields: ["p", ...]
+//   state/changed/topologies: ["mesh", ...]
+//
+// Anything not listed is considered unchanged. Without "state/changed"
+// everything is considered changed. Hints are only used for single 
+// domain meshes.
+//
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::UpdateGenerations(const conduit::Node &data)
+{
+    m_publish_count++;
+
+    // multi domain (or empty) data is not tracked
+    const bool single_domain = data.has_child("coordsets") &&
+                               data.has_child("topologies");
+
+    const bool has_hints = single_domain && data.has_path("state/changed");
+
+    // paths of everything we track, with their changed flags
+    std::vector<std::string> paths;
+    std::vector<int>         changed;
+
+    const char *groups[] = {"coordsets", "topologies", "fields"};
+    for(int g = 0; g < 3 && single_domain; g++)
+    {
+        if(!data.has_child(groups[g]))
+        {
+            continue;
+        }
+
+        NodeConstIterator itr = data[groups[g]].children();
+        while(itr.has_next())
+        {
+            itr.next();
+            std::string path = std::string(groups[g]) + "/" + itr.name();
+            paths.push_back(path);
+            changed.push_back(!has_hints || !m_generations.has_path(path));
+        }
+    }
+
+    if(has_hints)
+    {
+        std::set<std::string> hinted;
+        const Node &hints = data["state/changed"];
+
+        if(hints.has_child("fields"))
+        {
+            NodeConstIterator itr = hints["fields"].children();
+            while(itr.has_next())
+            {
+                hinted.insert("fields/" + itr.next().as_string());
+            }
+        }
+
+        if(hints.has_child("topologies"))
+        {
+            NodeConstIterator itr = hints["topologies"].children();
+            while(itr.has_next())
+            {
+                std::string topo_name = itr.next().as_string();
+                std::string topo_path = "topologies/" + topo_name;
+                hinted.insert(topo_path);
+                // a changed topology may come with changed coords
+                if(data.has_path(topo_path + "/coordset"))
+                {
+                    hinted.insert("coordsets/" + 
+                                  data[topo_path + "/coordset"].as_string());
+                }
+            }
+        }
+
+        for(size_t i = 0; i < paths.size(); i++)
+        {
+            if(hinted.find(paths[i]) != hinted.end())
+            {
+                changed[i] = 1;
+            }
+        }
+    }
+
+#if PARALLEL
+    // filters that use collectives must be skipped on all ranks or none,
+    // so a part changed on any rank is considered changed on all ranks.
+    // if the ranks publish different parts, consider everything changed.
+    MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+
+    // note: all ranks must take part, even ranks with untracked data
+    std::string all_paths = single_domain ? "" : "untracked;";
+    for(size_t i = 0; i < paths.size(); i++)
+    {
+        all_paths += paths[i] + ";";
+    }
+    int paths_id = (int)(std::hash<std::string>()(all_paths) & 0x3fffffff);
+
+    // max of the id and its negation tells us if all ranks agree
+    int paths_ids[2] = {paths_id, -paths_id};
+    int paths_ids_res[2];
+    MPI_Allreduce(paths_ids, paths_ids_res, 2, MPI_INT, MPI_MAX, mpi_comm);
+
+    if(paths_ids_res[0] != -paths_ids_res[1])
+    {
+        changed.assign(paths.size(), 1);
+    }
+    else if(!changed.empty())
+    {
+        std::vector<int> changed_res(changed.size());
+        MPI_Allreduce(&changed[0], &changed_res[0], (int)changed.size(),
+                      MPI_INT, MPI_MAX, mpi_comm);
+        changed = changed_res;
+    }
+#endif
+
+    if(!single_domain)
+    {
+        // everything is considered changed
+        m_generations.reset();
+        return;
+    }
+
+    Node gens;
+    for(size_t i = 0; i < paths.size(); i++)
+    {
+        if(changed[i])
+        {
+            gens[paths[i]] = m_publish_count;
+        }
+        else
+        {
+            gens[paths[i]] = m_generations[paths[i]].to_uint64();
+        }
+    }
+
+    m_generations.set(gens);
+    w.set_generations(m_generations);
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::ConnectSource()
+{
     // note: if the reg entry for data was already added
     // the set_external updates everything,
     // we don't need to remove and re-add.
@@ -235,8 +456,8 @@ AscentRuntime::CreateDefaultFilters()
                       "verify",
                       0);        // default port
 
-    w.graph().add_filter("ensure_vtkh",
-                         "vtkh_data");
+    m_ensure_vtkh = w.graph().add_filter("ensure_vtkh",
+                                         end_filter);
 
     w.graph().connect("verify",
                       "vtkh_data",
@@ -428,6 +649,103 @@ AscentRuntime::ConnectGraphs()
   }
 }
 
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// adds the values of all "field" and "topology" entries in params
+// (at any depth) to fields and topos
+//-----------------------------------------------------------------------------
+void
+collect_field_refs(const conduit::Node &params,
+                   std::set<std::string> &fields,
+                   std::set<std::string> &topos)
+{
+    NodeConstIterator itr = params.children();
+    while(itr.has_next())
+    {
+        const Node &child = itr.next();
+        std::string name = itr.name();
+
+        if(child.dtype().is_string())
+        {
+            if(name == "field")
+            {
+                fields.insert(child.as_string());
+            }
+            else if(name == "topology")
+            {
+                topos.insert(child.as_string());
+            }
+        }
+        else if(child.number_of_children() > 0)
+        {
+            collect_field_refs(child, fields, topos);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end namespace detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::ProjectFields()
+{
+    if(m_ensure_vtkh == NULL)
+    {
+        return;
+    }
+
+    //
+    // All filters that consume the vtk-h data are created by this
+    // runtime and name the fields and topology they use in their 
+    // params, so the conversion to vtk-h can skip everything else.
+    //
+    conduit::Node filters;
+    w.graph().filters(filters);
+
+    std::set<std::string> fields;
+    std::set<std::string> topos;
+
+    NodeConstIterator itr = filters.children();
+    while(itr.has_next())
+    {
+        const Node &filter = itr.next();
+        if(itr.name() != m_ensure_vtkh->name() && filter.has_child("params"))
+        {
+            detail::collect_field_refs(filter["params"], fields, topos);
+        }
+    }
+
+    conduit::Node &params = m_ensure_vtkh->params();
+    params.reset();
+
+    // domains are converted with the threads the workspace executes with
+    params["threads"] = w.number_of_threads();
+
+    conduit::Node &n_fields = params["fields"];
+    n_fields.set(DataType::list());
+    std::set<std::string>::const_iterator f_itr;
+    for(f_itr = fields.begin(); f_itr != fields.end(); f_itr++)
+    {
+        n_fields.append() = *f_itr;
+    }
+
+    // with more than one topology referenced, we keep converting the first
+    if(topos.size() == 1)
+    {
+        params["topology"] = *topos.begin();
+    }
+
+    ASCENT_INFO("Converting " << fields.size() << " field(s) to vtk-h");
+}
+
+//-----------------------------------------------------------------------------
 std::vector<std::string>
 AscentRuntime::GetPipelines(const conduit::Node &plots)
 {
@@ -450,6 +768,7 @@ AscentRuntime::GetPipelines(const conduit::Node &plots)
   return pipelines;
 }
 
+//-----------------------------------------------------------------------------
 std::string 
 AscentRuntime::GetDefaultImagePrefix(const std::string scene)
 {
@@ -476,7 +795,7 @@ AscentRuntime::CreateScenes(const conduit::Node &scenes)
   for(int i = 0; i < num_scenes; ++i)
   {
     conduit::Node scene = scenes.child(i);
-    scene.print();
+    ASCENT_DEBUG(scene.to_json());
     if(!scene.has_path("plots"))
     {
       ASCENT_ERROR("Default scene not implemented");
@@ -504,9 +823,13 @@ AscentRuntime::CreateScenes(const conduit::Node &scenes)
     render_params["pipeline_count"] = plot_count;
     std::string renders_name = names[i] + "_renders";           
     
-    w.graph().add_filter("default_render",
-                          renders_name,
-                          render_params);
+    flow::Filter *renders = w.graph().add_filter("default_render",
+                                                 renders_name,
+                                                 render_params);
+    if(!scene.has_path("image_prefix"))
+    {
+      m_default_prefix_renders[names[i]] = renders;
+    }
     //
     // TODO: detect if there is a volume plot, rendering it last
     //
@@ -526,9 +849,7 @@ AscentRuntime::CreateScenes(const conduit::Node &scenes)
     CreatePlots(appended_plots);
 
     std::vector<std::string> bounds_names;
-    std::vector<std::string> union_bounds_names;
     std::vector<std::string> domain_ids_names;
-    std::vector<std::string> union_domain_ids_names;
     
     for(int p = 0; p < plot_count; ++p)
     {
@@ -561,59 +882,6 @@ AscentRuntime::CreateScenes(const conduit::Node &scenes)
                         domain_ids_name,  // dest
                         0);               // default port
       domain_ids_names.push_back(domain_ids_name);
-  
-      //
-      // we have more than one. Create union filters.
-      //
-      if(p > 0)
-      {
-        std::string union_bounds_name = plot_names[p] + "_union_bounds";
-        w.graph().add_filter("vtkh_union_bounds",
-                              union_bounds_name,
-                              empty);
-        union_bounds_names.push_back(union_bounds_name);
-
-        std::string union_domain_ids_name = plot_names[p] + "_union_domain_ids";
-        w.graph().add_filter("vtkh_union_domain_ids",
-                              union_domain_ids_name,
-                              empty);
-        union_domain_ids_names.push_back(union_domain_ids_name);
-
-        if(p == 1)
-        {
-          // first union just needs the output
-          // of the first bounds
-          w.graph().connect(bounds_names[p-1],  // src
-                            union_bounds_name,  // dest
-                            0);                 // default port
-
-          w.graph().connect(domain_ids_names[p-1],  // src
-                            union_domain_ids_name,  // dest
-                            0);                     // default port
-        }
-        else
-        {
-          // all subsequent unions needs the bounds of 
-          // the current plot and the output of the 
-          // previous union
-          //
-          w.graph().connect(union_bounds_names[p-1],  // src
-                            union_bounds_name,        // dest
-                            0);                       // default port
-
-          w.graph().connect(union_domain_ids_names[p-1],  // src
-                            union_domain_ids_name,        // dest
-                            0);                           // default port
-        }
-
-        w.graph().connect(bounds_name,        // src
-                          union_bounds_name,  // dest
-                          1);                 // default port
-
-        w.graph().connect(domain_ids_name,        // src
-                          union_domain_ids_name,  // dest
-                          1);                     // default port
-      }
 
       //
       // Connect the render to the plots
@@ -644,20 +912,13 @@ AscentRuntime::CreateScenes(const conduit::Node &scenes)
     // Connect the total bounds and domain ids
     // up to the render inputs
     //
-    std::string bounds_output; 
-    std::string domain_ids_output; 
+    std::string bounds_output = CreateUnionTree("vtkh_union_bounds",
+                                                names[i] + "_union_bounds",
+                                                bounds_names);
 
-    if(bounds_names.size() == 1)
-    {
-      bounds_output = bounds_names[0];
-      domain_ids_output = domain_ids_names[0];
-    }
-    else
-    {
-      const size_t union_size = union_bounds_names.size();
-      bounds_output = union_bounds_names[union_size-1];
-      domain_ids_output = union_domain_ids_names[union_size-1];
-    }
+    std::string domain_ids_output = CreateUnionTree("vtkh_union_domain_ids",
+                                                    names[i] + "_union_domain_ids",
+                                                    domain_ids_names);
 
     w.graph().connect(bounds_output, // src
                       renders_name,  // dest
@@ -668,9 +929,129 @@ AscentRuntime::CreateScenes(const conduit::Node &scenes)
                       1);                // default port
   }
 }
+
+//-----------------------------------------------------------------------------
+std::string
+AscentRuntime::CreateUnionTree(const std::string &union_type,
+                               const std::string &union_prefix,
+                               const std::vector<std::string> &inputs)
+{
+    //
+    // Combine the outputs pairwise, level by level, so the depth of 
+    // the tree (and the size of the intermediate unions) grows with
+    // log(# of inputs) instead of the number of inputs.
+    //
+    std::vector<std::string> level = inputs;
+    int union_count = 0;
+    conduit::Node empty;
+
+    while(level.size() > 1)
+    {
+      std::vector<std::string> next_level;
+
+      for(size_t i = 0; i < level.size(); i += 2)
+      {
+        if(i + 1 == level.size())
+        {
+          // odd one out moves up a level
+          next_level.push_back(level[i]);
+          continue;
+        }
+
+        std::ostringstream oss;
+        oss << union_prefix << "_" << union_count++;
+        std::string union_name = oss.str();
+
+        w.graph().add_filter(union_type,
+                             union_name,
+                             empty);
+
+        w.graph().connect(level[i],    // src
+                          union_name,  // dest
+                          0);          // port a
+
+        w.graph().connect(level[i+1],  // src
+                          union_name,  // dest
+                          1);          // port b
+
+        next_level.push_back(union_name);
+      }
+
+      level.swap(next_level);
+    }
+
+    return level[0];
+}
+
 //-----------------------------------------------------------------------------
 void
-AscentRuntime::Execute(const conduit::Node &actions)
+AscentRuntime::ResetGraph()
+{
+    w.reset();
+    m_connections.reset();
+    m_default_prefix_renders.clear();
+    m_ensure_vtkh = NULL;
+    m_graph_compiled = false;
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::ExecuteCompiledGraph()
+{
+    // the graph is unchanged, only the default image prefixes
+    // advance with each cycle
+    std::map<std::string,flow::Filter*>::iterator itr;
+    for(itr  = m_default_prefix_renders.begin();
+        itr != m_default_prefix_renders.end();
+        itr++)
+    {
+        itr->second->params()["image_prefix"] = GetDefaultImagePrefix(itr->first);
+    }
+
+    w.execute();
+    w.registry().reset();
+    SaveProfile();
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::SaveProfile()
+{
+    if(!w.profiling())
+    {
+        return;
+    }
+
+    Node prof;
+    w.profile(prof);
+
+    index_t cycle = prof["execute_count"].to_index_t();
+    if(m_data.has_path("state/cycle"))
+    {
+        cycle = m_data["state/cycle"].to_index_t();
+    }
+
+    char fmt_buff[64];
+    snprintf(fmt_buff, sizeof(fmt_buff), "%06ld", (long)cycle);
+
+    std::ostringstream oss;
+    oss << "ascent_profile_cycle_" << fmt_buff;
+#if PARALLEL
+    int rank = 0;
+    MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+    MPI_Comm_rank(mpi_comm, &rank);
+    oss << "_rank_" << rank;
+#endif
+    oss << ".json";
+
+    std::string path = conduit::utils::join_file_path(m_profile_dir, oss.str());
+    prof.save(path, "json");
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::ExecuteActions(const conduit::Node &actions,
+                              bool keep_graph)
 {
     // Loop over the actions
     for (int i = 0; i < actions.number_of_children(); ++i)
@@ -693,17 +1074,69 @@ AscentRuntime::Execute(const conduit::Node &actions)
         else if( action_name == "execute")
         {
           ConnectGraphs();
-          ASCENT_INFO(w.graph().to_dot());
+          ProjectFields();
+          ASCENT_DEBUG(w.graph().to_dot());
           w.execute();
           w.registry().reset();
+          SaveProfile();
         }
         else if( action_name == "reset")
         {
-            w.reset();
+          if(keep_graph)
+          {
+            // the graph is kept for the next cycle 
+            w.registry().reset();
+          }
+          else
+          {
+            ResetGraph();
+          }
         }
     }
 }
 
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::Execute(const conduit::Node &actions)
+{
+    //
+    // In persistent mode, actions that end with a reset describe the
+    // whole graph for a cycle. We keep that graph (and its filters) 
+    // and, if the next cycle sends the same actions, execute it again
+    // with the newly published data instead of rebuilding it.
+    //
+    index_t num_actions = actions.number_of_children();
+    bool ends_with_reset = num_actions > 0 &&
+                           actions.child(num_actions-1).has_child("action") &&
+                           actions.child(num_actions-1)["action"].as_string() == "reset";
+
+    if(!m_persistent || !ends_with_reset)
+    {
+        ExecuteActions(actions,false);
+        return;
+    }
+
+    std::string actions_json = actions.to_json();
+    size_t actions_hash = std::hash<std::string>()(actions_json);
+
+    if(m_graph_compiled && 
+       actions_hash == m_actions_hash &&
+       actions_json == m_actions_json)
+    {
+        ExecuteCompiledGraph();
+        return;
+    }
+
+    // new actions: start from a clean graph, keeping the published data
+    ResetGraph();
+    ConnectSource();
+    ExecuteActions(actions,true);
+
+    m_actions_hash   = actions_hash;
+    m_actions_json   = actions_json;
+    m_graph_compiled = true;
+}
+
 
 
 
@@ -78,6 +78,7 @@ public:
 
     void  Publish(const conduit::Node &data);
     void  Execute(const conduit::Node &actions);
+    void  Info(conduit::Node &out);
     
     void  Cleanup();
 
@@ -89,7 +90,35 @@ private:
     conduit::Node     m_connections; 
     conduit::Node     m_scene_connections; 
 
+    // compile-once, execute-many support (see "runtime/persistent")
+    bool              m_persistent;
+    // true when the graph was built from m_actions_json and kept
+    bool              m_graph_compiled;
+    size_t            m_actions_hash;
+    std::string       m_actions_json;
+    // default render filters (by scene name) whose image prefix 
+    // changes each cycle
+    std::map<std::string,flow::Filter*> m_default_prefix_renders;
+    // the filter that converts the published data to vtk-h, 
+    // NULL until the default filters are created
+    flow::Filter     *m_ensure_vtkh;
+
+    // generation counters of the published coordsets, topologies 
+    // and fields (see UpdateGenerations)
+    conduit::Node     m_generations;
+    conduit::uint64   m_publish_count;
+
+    // where per cycle profiles are written (see "runtime/profiling")
+    std::string       m_profile_dir;
+
     flow::Workspace w;
+    void ConnectSource();
+    void UpdateGenerations(const conduit::Node &data);
+    void ResetGraph();
+    void ExecuteActions(const conduit::Node &actions,
+                        bool keep_graph);
+    void ExecuteCompiledGraph();
+    void SaveProfile();
     std::string CreateDefaultFilters();
     void ConvertToFlowGraph(const conduit::Node &pipeline,
                             const std::string pipeline_name);
@@ -100,8 +129,12 @@ private:
     void CreatePlots(const conduit::Node &plots);
     std::vector<std::string> GetPipelines(const conduit::Node &plots);
     void CreateScenes(const conduit::Node &scenes);
+    std::string CreateUnionTree(const std::string &union_type,
+                                const std::string &union_prefix,
+                                const std::vector<std::string> &inputs);
     void ConvertSceneToFlow(const conduit::Node &scenes);
     void ConnectGraphs();
+    void ProjectFields();
     void ExecuteGraphs();
     std::string GetDefaultImagePrefix(const std::string scene);
 };
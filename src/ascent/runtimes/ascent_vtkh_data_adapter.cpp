@@ -57,16 +57,30 @@
 #include <cstdlib>
 #include <sstream>
 #include <type_traits>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 // thirdparty includes
 
 // VTKm includes
 #define VTKM_USE_DOUBLE_PRECISION
 #include <vtkm/cont/DataSet.h>
+#include <vtkm/CellShape.h>
+#include <vtkm/cont/CellSetExplicit.h>
+#include <vtkm/cont/CellSetSingleType.h>
 #include <vtkh/DataSet.hpp>
 // other ascent includes
 #include <ascent_logging.hpp>
 #include <ascent_block_timer.hpp>
+
+#ifdef ASCENT_USE_OPENMP
+#include <omp.h>
+#endif
 #include <vtkh/utils/vtkm_array_utils.hpp>
 
 using namespace std;
@@ -78,6 +92,565 @@ using namespace conduit;
 namespace ascent
 {
 
+//-----------------------------------------------------------------------------
+// -- begin ascent::detail:: --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// maps vtk-m value types to conduit dtype ids
+//-----------------------------------------------------------------------------
+template<typename T> struct ConduitTypeId;
+
+template<> struct ConduitTypeId<vtkm::Float32> 
+{ static const index_t id = DataType::FLOAT32_ID; };
+
+template<> struct ConduitTypeId<vtkm::Float64> 
+{ static const index_t id = DataType::FLOAT64_ID; };
+
+template<> struct ConduitTypeId<vtkm::Int32> 
+{ static const index_t id = DataType::INT32_ID; };
+
+template<> struct ConduitTypeId<vtkm::Int64> 
+{ static const index_t id = DataType::INT64_ID; };
+
+template<> struct ConduitTypeId<vtkm::UInt8> 
+{ static const index_t id = DataType::UINT8_ID; };
+
+//-----------------------------------------------------------------------------
+// returns a vtk-m array handle with the first num_vals values of n_vals.
+// contiguous arrays of type T (at any offset) are wrapped w/o a copy,
+// strided arrays of type T (e.g. array-of-structs) are gathered, and 
+// arrays of other types are converted to T, into memory owned by the 
+// handle.
+//-----------------------------------------------------------------------------
+template<typename T>
+vtkm::cont::ArrayHandle<T>
+GetArrayHandle(const Node &n_vals, vtkm::Id num_vals)
+{
+    const DataType &dtype = n_vals.dtype();
+
+    if(dtype.number_of_elements() < num_vals)
+    {
+        ASCENT_ERROR("Array has " << dtype.number_of_elements() 
+                     << " values, expected at least " << num_vals);
+    }
+
+    if(dtype.id() == ConduitTypeId<T>::id)
+    {
+        // element_ptr accounts for the offset
+        const char *vals_ptr = static_cast<const char*>(n_vals.element_ptr(0));
+        const index_t stride = dtype.stride();
+
+        if(stride == (index_t)sizeof(T))
+        {
+            //This is the method for zero copy
+            return vtkm::cont::make_ArrayHandle(reinterpret_cast<const T*>(vals_ptr),
+                                                num_vals);
+        }
+
+        // vtk-h filters only accept basic storage, so strided values 
+        // are compacted
+        vtkm::cont::ArrayHandle<T> res;
+        res.Allocate(num_vals);
+        T *res_ptr = vtkh::GetVTKMPointer(res);
+#ifdef ASCENT_USE_OPENMP
+        #pragma omp parallel for
+#endif
+        for(vtkm::Id i = 0; i < num_vals; ++i)
+        {
+            memcpy(res_ptr + i, vals_ptr + i * stride, sizeof(T));
+        }
+        return res;
+    }
+
+    Node n_conv;
+    n_vals.to_data_type(ConduitTypeId<T>::id, n_conv);
+
+    vtkm::cont::ArrayHandle<T> res;
+    res.Allocate(num_vals);
+    memcpy(vtkh::GetVTKMPointer(res),
+           n_conv.data_ptr(),
+           num_vals * sizeof(T));
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// returns a new zero filled float64 array handle with num_vals values, 
+// used as the z coordinate of 2D meshes.
+//
+// vtk-h only accepts coordinate systems with the default storage types, so 
+// an implicit (constant) array can't be used. each data set gets its own
+// array, array handles aren't safe to share between filters that execute
+// concurrently.
+//-----------------------------------------------------------------------------
+vtkm::cont::ArrayHandle<vtkm::Float64>
+ZeroArrayHandle(vtkm::Id num_vals)
+{
+    vtkm::cont::ArrayHandle<vtkm::Float64> res;
+    res.Allocate(num_vals); 
+    // This does not get initialized to zero
+    vtkm::Float64 *res_ptr = vtkh::GetVTKMPointer(res);
+#ifdef ASCENT_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for(vtkm::Id i = 0; i < num_vals; ++i)
+    {
+        res_ptr[i] = 0.0;
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// true if x, y and z are float64 values interleaved in one array
+// (x0,y0,z0,x1,...), which can be used as vtk-m vectors w/o a copy
+//-----------------------------------------------------------------------------
+bool
+IsInterleavedXYZ(const Node &n_x, const Node &n_y, const Node &n_z)
+{
+    const index_t vec_bytes = 3 * sizeof(vtkm::Float64);
+    const char *x_ptr = static_cast<const char*>(n_x.element_ptr(0));
+    const Node *comps[3] = {&n_x, &n_y, &n_z};
+
+    for(int c = 0; c < 3; c++)
+    {
+        const DataType &dtype = comps[c]->dtype();
+        const char *c_ptr = static_cast<const char*>(comps[c]->element_ptr(0));
+
+        if(!dtype.is_float64() ||
+           dtype.stride() != vec_bytes ||
+           c_ptr != x_ptr + c * sizeof(vtkm::Float64))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// adds a coordinate system for explicit (structured or unstructured) 
+// coords with nverts points
+//-----------------------------------------------------------------------------
+void
+AddExplicitCoordinateSystem(const std::string &coords_name,
+                            const Node &n_coords,
+                            vtkm::Id nverts,
+                            vtkm::cont::DataSet *dset)
+{
+    const Node &n_x = n_coords["values/x"];
+    const Node &n_y = n_coords["values/y"];
+
+    if(n_coords.has_path("values/z") &&
+       IsInterleavedXYZ(n_x, n_y, n_coords["values/z"]) &&
+       n_x.dtype().number_of_elements() >= nverts)
+    {
+        typedef vtkm::Vec<vtkm::Float64,3> Vec3;
+        const Vec3 *xyz_ptr = static_cast<const Vec3*>(n_x.element_ptr(0));
+        vtkm::cont::ArrayHandle<Vec3> xyz = vtkm::cont::make_ArrayHandle(xyz_ptr,
+                                                                        nverts);
+        dset->AddCoordinateSystem(
+          vtkm::cont::CoordinateSystem(coords_name.c_str(), xyz));
+        return;
+    }
+
+    // coordinate systems use FloatDefault (float64) values, 
+    // other types are converted
+    vtkm::cont::ArrayHandle<vtkm::Float64> x_coords_handle;
+    vtkm::cont::ArrayHandle<vtkm::Float64> y_coords_handle;
+    vtkm::cont::ArrayHandle<vtkm::Float64> z_coords_handle;
+    
+    x_coords_handle = GetArrayHandle<vtkm::Float64>(n_x, nverts);
+    y_coords_handle = GetArrayHandle<vtkm::Float64>(n_y, nverts);
+
+    if(n_coords.has_path("values/z"))
+    {
+        z_coords_handle = GetArrayHandle<vtkm::Float64>(n_coords["values/z"], nverts);
+    }
+    else 
+    {
+        z_coords_handle = ZeroArrayHandle(nverts);
+    }
+
+    dset->AddCoordinateSystem(
+      vtkm::cont::CoordinateSystem(coords_name.c_str(),
+        make_ArrayHandleCompositeVector(x_coords_handle,
+                                        0,
+                                        y_coords_handle,
+                                        0,
+                                        z_coords_handle,
+                                        0)));
+}
+
+//-----------------------------------------------------------------------------
+// adds a vertex or element associated field with values of type T
+//-----------------------------------------------------------------------------
+template<typename T>
+void
+AddFieldArray(const std::string &field_name,
+              const Node &n_vals,
+              const std::string &assoc,
+              const std::string &topo_name,
+              int neles,
+              int nverts,
+              vtkm::cont::DataSet *dset)
+{
+    if(assoc == "vertex")
+    {
+        vtkm::cont::ArrayHandle<T> vtkm_arr = GetArrayHandle<T>(n_vals, nverts);
+        dset->AddField(vtkm::cont::Field(field_name.c_str(),
+                                         vtkm::cont::Field::ASSOC_POINTS,
+                                         vtkm_arr));
+    }
+    else if( assoc == "element")
+    {
+        vtkm::cont::ArrayHandle<T> vtkm_arr = GetArrayHandle<T>(n_vals, neles);
+        dset->AddField(vtkm::cont::Field(field_name.c_str(),
+                                         vtkm::cont::Field::ASSOC_CELL_SET,
+                                         topo_name.c_str(),
+                                         vtkm_arr));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// state shared by the threads that convert the domains of a mesh
+//-----------------------------------------------------------------------------
+struct DomainConversion
+{
+    const std::vector<const Node*>     *domains;
+    const std::string                  *topo_name;
+    const std::set<std::string>        *field_names;
+    std::vector<vtkm::cont::DataSet*>  *dsets;
+    // true if more than one thread converts domains
+    bool                                concurrent;
+    // index of the next domain to convert
+    std::atomic<int>                    next;
+    // first error thrown by a conversion
+    std::mutex                          error_mutex;
+    std::exception_ptr                  error;
+};
+
+//-----------------------------------------------------------------------------
+void
+convert_domains(DomainConversion *conv)
+{
+    const int num_domains = (int)conv->domains->size();
+
+#ifdef ASCENT_USE_OPENMP
+    // domains are already converted concurrently, don't nest omp
+    // teams inside the conversion threads
+    const int omp_threads = omp_get_max_threads();
+    if(conv->concurrent)
+    {
+        omp_set_num_threads(1);
+    }
+#endif
+
+    for(int i = conv->next++; i < num_domains; i = conv->next++)
+    {
+        try
+        {
+            (*conv->dsets)[i] = 
+                VTKHDataAdapter::BlueprintToVTKmDataSet(*(*conv->domains)[i],
+                                                        *conv->topo_name,
+                                                        conv->field_names);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(conv->error_mutex);
+            if(!conv->error)
+            {
+                conv->error = std::current_exception();
+            }
+        }
+    }
+
+#ifdef ASCENT_USE_OPENMP
+    omp_set_num_threads(omp_threads);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// Helper that provides the vtk-m shape id, number of points and 
+// topological dimension of a blueprint element shape
+//-----------------------------------------------------------------------------
+void
+GetShapeInfo(const std::string &shape_type,
+             vtkm::UInt8 &shape_id,
+             vtkm::IdComponent &indices,
+             vtkm::IdComponent &dimensionality)
+{
+    shape_id = 0;
+    indices  = 0;
+    if(shape_type == "tri")
+    {
+        shape_id = vtkm::CELL_SHAPE_TRIANGLE;
+        indices = 3; 
+        // note: vtkm cell dimensions are topological
+        dimensionality = 2; 
+    }
+    else if(shape_type == "quad")
+    {
+        shape_id = vtkm::CELL_SHAPE_QUAD;
+        indices = 4; 
+        // note: vtkm cell dimensions are topological
+        dimensionality = 2; 
+    }
+    else if(shape_type == "tet")
+    {
+        shape_id = vtkm::CELL_SHAPE_TETRA;
+        indices = 4; 
+        dimensionality = 3; 
+    }
+    else if(shape_type == "hex")
+    {
+        shape_id = vtkm::CELL_SHAPE_HEXAHEDRON;
+        indices = 8;
+        dimensionality = 3; 
+    }
+    else if(shape_type == "wedge")
+    {
+        shape_id = vtkm::CELL_SHAPE_WEDGE;
+        indices = 6;
+        dimensionality = 3;
+    }
+    else if(shape_type == "pyramid")
+    {
+        shape_id = vtkm::CELL_SHAPE_PYRAMID;
+        indices = 5;
+        dimensionality = 3;
+    }
+    else
+    {
+        ASCENT_ERROR("Unsupported element shape " << shape_type);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Helper that computes the exclusive prefix sum of the element sizes, 
+// which gives the offset of each element into the connectivity array.
+// returns the total size
+//-----------------------------------------------------------------------------
+vtkm::Id
+ExclusiveScan(const vtkm::IdComponent *sizes,
+              vtkm::Id *offsets,
+              vtkm::Id num_vals)
+{
+    vtkm::Id total = 0;
+#ifdef ASCENT_USE_OPENMP
+    // each thread scans a contiguous block, the block sums are scanned
+    // serially, then each thread adds the sum of the blocks before it
+    std::vector<vtkm::Id> block_sums;
+    #pragma omp parallel
+    {
+        const int num_blocks = omp_get_num_threads();
+        const int block = omp_get_thread_num();
+        #pragma omp single
+        block_sums.resize(num_blocks + 1, 0);
+
+        // note: vtkm::Id is 32-bit, compute the bounds in 64-bit
+        const vtkm::Id begin = (vtkm::Id)(((int64)num_vals * block) / num_blocks);
+        const vtkm::Id end   = (vtkm::Id)(((int64)num_vals * (block + 1)) / num_blocks);
+        vtkm::Id sum = 0;
+        for(vtkm::Id i = begin; i < end; ++i)
+        {
+            offsets[i] = sum;
+            sum += sizes[i];
+        }
+        block_sums[block + 1] = sum;
+
+        #pragma omp barrier
+        #pragma omp single
+        for(int b = 0; b < num_blocks; ++b)
+        {
+            block_sums[b + 1] += block_sums[b];
+        }
+
+        const vtkm::Id block_offset = block_sums[block];
+        for(vtkm::Id i = begin; i < end; ++i)
+        {
+            offsets[i] += block_offset;
+        }
+    }
+    total = block_sums.back();
+#else
+    for(vtkm::Id i = 0; i < num_vals; ++i)
+    {
+        offsets[i] = total;
+        total += sizes[i];
+    }
+#endif
+    return total;
+}
+
+//-----------------------------------------------------------------------------
+// Helper that checks that each element has a shape from the shape map,
+// the number of points of that shape, and an offset and size within the
+// connectivity array. shape_sizes holds the number of points of each 
+// vtk-m shape id in the shape map (0 for other ids)
+//-----------------------------------------------------------------------------
+bool
+ValidElements(const vtkm::UInt8 *shapes,
+              const std::vector<vtkm::IdComponent> &shape_sizes,
+              const vtkm::IdComponent *sizes,
+              const vtkm::Id *offsets,
+              vtkm::Id num_vals,
+              vtkm::Id conn_size)
+{
+    const vtkm::IdComponent *shape_sizes_ptr = &shape_sizes[0];
+    bool valid = true;
+#ifdef ASCENT_USE_OPENMP
+    #pragma omp parallel for reduction(&&:valid)
+#endif
+    for(vtkm::Id i = 0; i < num_vals; ++i)
+    {
+        valid = valid &&
+                shape_sizes_ptr[shapes[i]] != 0 &&
+                sizes[i] == shape_sizes_ptr[shapes[i]] &&
+                offsets[i] >= 0 &&
+                (int64)offsets[i] + sizes[i] <= (int64)conn_size;
+    }
+    return valid;
+}
+
+//-----------------------------------------------------------------------------
+// Helper that creates an explicit cell set for a blueprint topology with 
+// mixed element shapes ("shape" == "mixed"). Elements are described by 
+// the "shapes", "sizes" and (optional) "offsets" arrays, with 
+// "shape_map" mapping shape names to the values used in "shapes".
+//-----------------------------------------------------------------------------
+void
+AddMixedCellSet(const std::string &topo_name,
+                const Node &n_topo_eles,
+                const vtkm::cont::ArrayHandle<vtkm::Id> &connectivity,
+                vtkm::Id conn_size,
+                int nverts,
+                int &neles,
+                vtkm::cont::DataSet *dset)
+{
+    if(!n_topo_eles.has_child("shape_map") ||
+       !n_topo_eles.has_child("shapes") ||
+       !n_topo_eles.has_child("sizes"))
+    {
+        ASCENT_ERROR("Mixed element topology '" << topo_name << "'"
+                     << " requires 'shape_map', 'shapes' and 'sizes'");
+    }
+
+    const Node &n_shapes = n_topo_eles["shapes"];
+    const Node &n_sizes  = n_topo_eles["sizes"];
+
+    neles = (int) n_shapes.dtype().number_of_elements();
+
+    // map the blueprint shape values to vtk-m shape ids, if they already
+    // match, uint8 shapes can be used w/o a copy
+    std::map<int64, vtkm::UInt8> shape_ids;
+    // number of points of the shapes in the map, by vtk-m shape id
+    std::vector<vtkm::IdComponent> shape_sizes(256, 0);
+    bool identity_map = true;
+    NodeConstIterator itr = n_topo_eles["shape_map"].children();
+    while(itr.has_next())
+    {
+        const Node &n_shape_val = itr.next();
+        vtkm::UInt8 shape_id;
+        vtkm::IdComponent indices;
+        vtkm::IdComponent topo_dimensionality;
+        GetShapeInfo(itr.name(),
+                     shape_id,
+                     indices,
+                     topo_dimensionality);
+
+        const int64 shape_val = n_shape_val.to_int64();
+        shape_ids[shape_val] = shape_id;
+        shape_sizes[shape_id] = indices;
+        identity_map = identity_map && shape_val == (int64) shape_id;
+    }
+
+    vtkm::cont::ArrayHandle<vtkm::UInt8> shapes;
+    if(identity_map && n_shapes.dtype().is_uint8())
+    {
+        shapes = GetArrayHandle<vtkm::UInt8>(n_shapes, neles);
+    }
+    else
+    {
+        vtkm::cont::ArrayHandle<vtkm::Int64> shape_vals =
+            GetArrayHandle<vtkm::Int64>(n_shapes, neles);
+        const vtkm::Int64 *shape_vals_ptr = vtkh::GetVTKMPointer(shape_vals);
+
+        shapes.Allocate(neles);
+        vtkm::UInt8 *shapes_ptr = vtkh::GetVTKMPointer(shapes);
+
+        // shapes that are not in the map are left empty, and are 
+        // reported by the elements check below
+#ifdef ASCENT_USE_OPENMP
+        #pragma omp parallel for
+#endif
+        for(int i = 0; i < neles; ++i)
+        {
+            std::map<int64, vtkm::UInt8>::const_iterator s_itr = 
+                shape_ids.find(shape_vals_ptr[i]);
+            if(s_itr == shape_ids.end())
+            {
+                shapes_ptr[i] = vtkm::CELL_SHAPE_EMPTY;
+            }
+            else
+            {
+                shapes_ptr[i] = s_itr->second;
+            }
+        }
+    }
+
+    // compact int32 sizes and offsets are used w/o a copy
+    vtkm::cont::ArrayHandle<vtkm::IdComponent> sizes = 
+        GetArrayHandle<vtkm::IdComponent>(n_sizes, neles);
+
+    vtkm::cont::ArrayHandle<vtkm::Id> offsets;
+    if(n_topo_eles.has_child("offsets"))
+    {
+        offsets = GetArrayHandle<vtkm::Id>(n_topo_eles["offsets"], neles);
+    }
+    else
+    {
+        offsets.Allocate(neles);
+        vtkm::Id total = ExclusiveScan(vtkh::GetVTKMPointer(sizes),
+                                       vtkh::GetVTKMPointer(offsets),
+                                       neles);
+        if(total != conn_size)
+        {
+            ASCENT_ERROR("Mixed element topology '" << topo_name << "'"
+                         << " element sizes sum to " << total 
+                         << ", but the connectivity array has size " 
+                         << conn_size);
+        }
+    }
+
+    if(!ValidElements(vtkh::GetVTKMPointer(shapes),
+                      shape_sizes,
+                      vtkh::GetVTKMPointer(sizes),
+                      vtkh::GetVTKMPointer(offsets),
+                      neles,
+                      conn_size))
+    {
+        ASCENT_ERROR("Mixed element topology '" << topo_name << "'"
+                     << " has elements with shapes that are not in its"
+                     << " 'shape_map', sizes that don't match their shape,"
+                     << " or offsets outside of the connectivity array"
+                     << " (size " << conn_size << ")");
+    }
+
+    vtkm::cont::CellSetExplicit<> cell_set(topo_name.c_str());
+
+    cell_set.Fill(nverts, shapes, sizes, connectivity, offsets);
+
+    dset->AddCellSet(cell_set);
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::detail:: --
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 // VTKHDataAdapter public methods
 //-----------------------------------------------------------------------------
@@ -85,31 +658,93 @@ namespace ascent
 //-----------------------------------------------------------------------------
 vtkh::DataSet *
 VTKHDataAdapter::BlueprintToVTKHDataSet(const Node &node,
-                                    const std::string &topo_name)
+                                    const std::string &topo_name,
+                                    const std::set<std::string> *field_names,
+                                    int num_threads)
 {   
-    // TODO: check for multi-domain case:
+    ASCENT_BLOCK_TIMER(blueprint_to_vtkh);
 
-    vtkm::cont::DataSet *dset = VTKHDataAdapter::BlueprintToVTKmDataSet(node,
-                                                                    topo_name);
-    
-    int domain_id = 0;
-    if(!node.has_path("state/domain_id"))
+    // a single domain has its coordsets at the top level, 
+    // a multi-domain mesh has one child per domain
+    std::vector<const Node*> domains;
+    if(node.has_child("coordsets"))
     {
-        domain_id = node["state/domain_id"].to_int();
+        domains.push_back(&node);
     }
-#ifdef PARALLEL
     else
     {
-       domain_id = vtkh::GetMPIRank();
+        NodeConstIterator itr = node.children();
+        while(itr.has_next())
+        {
+            domains.push_back(&itr.next());
+        }
+    }
+
+    const int num_domains = (int)domains.size();
+    std::vector<vtkm::cont::DataSet*> dsets(num_domains,NULL);
+
+    //
+    // domains are independent, convert them concurrently using 
+    // up to num_threads threads
+    //
+    num_threads = std::max(1,std::min(num_threads,num_domains));
+
+    detail::DomainConversion conv;
+    conv.domains     = &domains;
+    conv.topo_name   = &topo_name;
+    conv.field_names = field_names;
+    conv.dsets       = &dsets;
+    conv.concurrent  = num_threads > 1;
+    conv.next        = 0;
+
+    std::vector<std::thread> threads;
+    for(int t = 1; t < num_threads; t++)
+    {
+        threads.push_back(std::thread(detail::convert_domains,&conv));
+    }
+
+    detail::convert_domains(&conv);
+
+    for(size_t t = 0; t < threads.size(); t++)
+    {
+        threads[t].join();
     }
+
+    if(conv.error)
+    {
+        for(int i = 0; i < num_domains; i++)
+        {
+            delete dsets[i];
+        }
+        std::rethrow_exception(conv.error);
+    }
+
+    // domains w/o a domain id are numbered so that ids are unique across
+    // ranks w/o communication (a single domain gets the rank)
+    int rank = 0;
+    int num_ranks = 1;
+#ifdef PARALLEL
+    rank      = vtkh::GetMPIRank();
+    num_ranks = vtkh::GetMPISize();
 #endif
 
     vtkh::DataSet *res = new vtkh::DataSet;
-    res->AddDomain(*dset,domain_id);
-    
-    // vtk-m will shallow copy the data assoced with dset
-    // clean up our copy
-    delete dset;
+
+    for(int i = 0; i < num_domains; i++)
+    {
+        const Node &dom = *domains[i];
+        int domain_id = i * num_ranks + rank;
+        if(dom.has_path("state/domain_id"))
+        {
+            domain_id = dom["state/domain_id"].to_int();
+        }
+
+        res->AddDomain(*dsets[i],domain_id);
+
+        // vtk-m will shallow copy the data assoced with dset
+        // clean up our copy
+        delete dsets[i];
+    }
     
     return res;
 }
@@ -128,7 +763,8 @@ VTKHDataAdapter::VTKmDataSetToVTKHDataSet(vtkm::cont::DataSet *dset)
 //-----------------------------------------------------------------------------
 vtkm::cont::DataSet *
 VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
-                                    const std::string &topo_name_str)
+                                    const std::string &topo_name_str,
+                                    const std::set<std::string> *field_names)
 {   
     vtkm::cont::DataSet * result = NULL;
 
@@ -204,7 +840,7 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
     
     if(node.has_child("fields"))
     {
-        // add all of the fields:
+        // add the fields:
         NodeConstIterator itr = node["fields"].children();
         while(itr.has_next())
         {
@@ -212,6 +848,13 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
             const Node &n_field = itr.next();
             std::string field_name = itr.name();
 
+            // skip fields that were not asked for
+            if(field_names != NULL && 
+               field_names->find(field_name) == field_names->end())
+            {
+                continue;
+            }
+
             // skip vector fields for now, we need to add
             // more logic to AddField
             if(n_field["values"].number_of_children() == 0 )
@@ -231,93 +874,6 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
 }
 
 
-//-----------------------------------------------------------------------------
-class ExplicitArrayHelper
-{
-public:
-// Helper function to create explicit coordinate arrays for vtkm data sets
-void CreateExplicitArrays(vtkm::cont::ArrayHandle<vtkm::UInt8> &shapes,
-                          vtkm::cont::ArrayHandle<vtkm::IdComponent> &num_indices,
-                          const std::string &shape_type,
-                          const vtkm::Id &conn_size,
-                          vtkm::IdComponent &dimensionality,
-                          int &neles)
-{
-    vtkm::UInt8 shape_id = 0;
-    vtkm::IdComponent indices= 0;
-    if(shape_type == "tri")
-    {
-        shape_id = 3;
-        indices = 3; 
-        // note: vtkm cell dimensions are topological
-        dimensionality = 2; 
-    }
-    else if(shape_type == "quad")
-    {
-        shape_id = 9;
-        indices = 4; 
-        // note: vtkm cell dimensions are topological
-        dimensionality = 2; 
-    }
-    else if(shape_type == "tet")
-    {
-        shape_id = 10;
-        indices = 4; 
-        dimensionality = 3; 
-    }
-    else if(shape_type == "hex")
-    {
-        shape_id = 12;
-        indices = 8;
-        dimensionality = 3; 
-    }
-    // TODO: Not supported in blueprint yet ... 
-    // else if(shape_type == "wedge")
-    // {
-    //     shape_id = 13;
-    //     indices = 6;
-    //     dimensionality = 3;
-    // }
-    // else if(shape_type == "pyramid")
-    // {
-    //     shape_id = 14;
-    //     indices = 5;
-    //     dimensionality = 3;
-    // }
-    else
-    {
-        ASCENT_ERROR("Unsupported element shape " << shape_type);
-    }
-
-    if(conn_size < indices) 
-        ASCENT_ERROR("Connectivity array size " <<conn_size << " must be at least size " << indices);
-    if(conn_size % indices != 0) 
-        ASCENT_ERROR("Connectivity array size " <<conn_size << " be evenly divided by indices size" << indices);
-
-    const vtkm::Id num_shapes = conn_size / indices;
-
-    neles = num_shapes;
-
-    shapes.Allocate(num_shapes);
-    num_indices.Allocate(num_shapes);
-
-    // We could memset these and then zero copy them but that 
-    // would make us responsible for the data. If we just create
-    // them, smart pointers will automatically delete them.
-    // Hopefull the compiler turns this into a memset.
-
-    const vtkm::UInt8 shape_value = shape_id;
-    const vtkm::IdComponent indices_value = indices;
-#ifdef ASCENT_USE_OPENMP
-    #pragma omp parrallel for
-#endif
-    for (int i = 0; i < num_shapes; ++i)
-    {
-        shapes.GetPortalControl().Set(i, shape_value);
-        num_indices.GetPortalControl().Set(i, indices_value);
-    }
-}
-};
 //-----------------------------------------------------------------------------
 
 vtkm::cont::DataSet *
@@ -460,28 +1016,24 @@ VTKHDataAdapter::RectilinearBlueprintToVTKmDataSet
 
     int32 ndims = 2;
     
-    // todo assumes float64
-    const float64 *x_coords_ptr = n_coords["values/x"].as_float64_ptr();
-    const float64 *y_coords_ptr = n_coords["values/y"].as_float64_ptr();
-    const float64 *z_coords_ptr = NULL;
-    
     if(n_coords.has_path("values/z"))
     {
         ndims = 3;
         z_npts = n_coords["values/z"].dtype().number_of_elements();
-        z_coords_ptr = n_coords["values/z"].as_float64_ptr();
     }
 
+    // coordinate systems use FloatDefault (float64) values, 
+    // other types are converted
     vtkm::cont::ArrayHandle<vtkm::Float64> x_coords_handle;
     vtkm::cont::ArrayHandle<vtkm::Float64> y_coords_handle;
     vtkm::cont::ArrayHandle<vtkm::Float64> z_coords_handle;
     
-    x_coords_handle = vtkm::cont::make_ArrayHandle(x_coords_ptr, x_npts);
-    y_coords_handle = vtkm::cont::make_ArrayHandle(y_coords_ptr, y_npts);
+    x_coords_handle = detail::GetArrayHandle<vtkm::Float64>(n_coords["values/x"], x_npts);
+    y_coords_handle = detail::GetArrayHandle<vtkm::Float64>(n_coords["values/y"], y_npts);
 
     if(ndims == 3)
     {
-        z_coords_handle = vtkm::cont::make_ArrayHandle(z_coords_ptr, z_npts);
+        z_coords_handle = detail::GetArrayHandle<vtkm::Float64>(n_coords["values/z"], z_npts);
     }
     else
     {
@@ -549,43 +1101,17 @@ VTKHDataAdapter::StructuredBlueprintToVTKmDataSet
 
     int32 ndims = 2;
     
-    const float64 *x_coords_ptr = n_coords["values/x"].as_float64_ptr();
-    const float64 *y_coords_ptr = n_coords["values/y"].as_float64_ptr();
-    const float64 *z_coords_ptr = NULL;
-    
     if(n_coords.has_path("values/z"))
     {
         ndims = 3;
-        z_coords_ptr = n_coords["values/z"].as_float64_ptr();
     }
 
-    vtkm::cont::ArrayHandle<vtkm::Float64> x_coords_handle;
-    vtkm::cont::ArrayHandle<vtkm::Float64> y_coords_handle;
-    vtkm::cont::ArrayHandle<vtkm::Float64> z_coords_handle;
-    
-    x_coords_handle = vtkm::cont::make_ArrayHandle(x_coords_ptr, nverts);
-    y_coords_handle = vtkm::cont::make_ArrayHandle(y_coords_ptr, nverts);
+    detail::AddExplicitCoordinateSystem(coords_name,
+                                        n_coords,
+                                        nverts,
+                                        result);
 
-    if(ndims == 3)
-    {
-        z_coords_handle = vtkm::cont::make_ArrayHandle(z_coords_ptr, nverts);
-    }
-    else 
-    {
-        z_coords_handle.Allocate(nverts); 
-        // This does not get initialized to zero
-        vtkm::Float64 *z = vtkh::GetVTKMPointer(z_coords_handle);
-        memset(z, 0.0, nverts * sizeof(vtkm::Float64));
-    }
-    result->AddCoordinateSystem(
-      vtkm::cont::CoordinateSystem(coords_name.c_str(),
-        make_ArrayHandleCompositeVector(x_coords_handle,
-                                        0,
-                                        y_coords_handle,
-                                        0,
-                                        z_coords_handle,
-                                        0)));
-    n_topo.print();
+    ASCENT_DEBUG(n_topo.to_json());
     int32 x_elems = n_topo["elements/dims/i"].as_int32(); 
     int32 y_elems = n_topo["elements/dims/j"].as_int32(); 
     if (ndims == 2)
@@ -626,78 +1152,59 @@ VTKHDataAdapter::UnstructuredBlueprintToVTKmDataSet
     vtkm::cont::DataSet *result = new vtkm::cont::DataSet();
 
     nverts = n_coords["values/x"].dtype().number_of_elements();
-    
 
-    int32 ndims = 2;
-    
-    const float64 *x_coords_ptr = n_coords["values/x"].as_float64_ptr();
-    const float64 *y_coords_ptr = n_coords["values/y"].as_float64_ptr();
-    const float64 *z_coords_ptr = NULL;
-    
-    if(n_coords.has_path("values/z"))
-    {
-        ndims = 3;
-        z_coords_ptr = n_coords["values/z"].as_float64_ptr();
-    }
-
-    vtkm::cont::ArrayHandle<vtkm::Float64> x_coords_handle;
-    vtkm::cont::ArrayHandle<vtkm::Float64> y_coords_handle;
-    vtkm::cont::ArrayHandle<vtkm::Float64> z_coords_handle;
-    
-    x_coords_handle = vtkm::cont::make_ArrayHandle(x_coords_ptr, nverts);
-    y_coords_handle = vtkm::cont::make_ArrayHandle(y_coords_ptr, nverts);
-
-    if(ndims == 3)
-    {
-        z_coords_handle = vtkm::cont::make_ArrayHandle(z_coords_ptr, nverts);
-    }
-    else 
-    {
-        z_coords_handle.Allocate(nverts); 
-        // This does not get initialized to zero
-        for(int i = 0; i < nverts; ++i)
-            z_coords_handle.GetPortalControl().Set(i,0.0);
-    }
-    result->AddCoordinateSystem(
-      vtkm::cont::CoordinateSystem(coords_name.c_str(),
-        make_ArrayHandleCompositeVector(x_coords_handle,
-                                        0,
-                                        y_coords_handle,
-                                        0,
-                                        z_coords_handle,
-                                        0)));
+    detail::AddExplicitCoordinateSystem(coords_name,
+                                        n_coords,
+                                        nverts,
+                                        result);
 
 
-    // shapes, number of indices, and connectivity.
-    // Will have to do something different if this is a "zoo"
-
-    // TODO: there is a special data set type for single cell types
+    // shape and connectivity.
 
     const Node &n_topo_eles = n_topo["elements"];
     std::string ele_shape = n_topo_eles["shape"].as_string();
 
-    // TODO: assumes int32, and contiguous
-    const int32 *ele_idx_ptr = n_topo_eles["connectivity"].value();
     int32 conn_size = n_topo_eles["connectivity"].dtype().number_of_elements();
     static_assert(std::is_same<vtkm::Id, int>::value,
                   "VTK-m needs to be configured with 'VTKm_USE_64_BIT_IDS=OFF'");
-    vtkm::cont::ArrayHandle<vtkm::Id> connectivity = vtkm::cont::make_ArrayHandle(ele_idx_ptr,
-                                                                                  conn_size);
+    // compact int32 connectivity is used w/o a copy
+    vtkm::cont::ArrayHandle<vtkm::Id> connectivity = 
+        detail::GetArrayHandle<vtkm::Id>(n_topo_eles["connectivity"], conn_size);
+
+    if(ele_shape == "mixed")
+    {
+        detail::AddMixedCellSet(topo_name,
+                                n_topo_eles,
+                                connectivity,
+                                conn_size,
+                                nverts,
+                                neles,
+                                result);
+
+        ASCENT_DEBUG("neles "  << neles);
+        return result;
+    }
     
-    vtkm::cont::ArrayHandle<vtkm::UInt8> shapes;
-    vtkm::cont::ArrayHandle<vtkm::IdComponent> num_indices;
+    vtkm::UInt8 shape_id;
+    vtkm::IdComponent indices;
     vtkm::IdComponent topo_dimensionality;
-    ExplicitArrayHelper array_creator;
-    array_creator.CreateExplicitArrays(shapes,
-                                       num_indices,
-                                       ele_shape,
-                                       conn_size,
-                                       topo_dimensionality,
-                                       neles);
-    
-    vtkm::cont::CellSetExplicit<> cell_set(topo_name.c_str());
+    detail::GetShapeInfo(ele_shape,
+                         shape_id,
+                         indices,
+                         topo_dimensionality);
+
+    if(conn_size < indices) 
+        ASCENT_ERROR("Connectivity array size " <<conn_size << " must be at least size " << indices);
+    if(conn_size % indices != 0) 
+        ASCENT_ERROR("Connectivity array size " <<conn_size << " be evenly divided by indices size" << indices);
+
+    neles = conn_size / indices;
+
+    // all elements have the same shape, so the shapes and number of 
+    // indices per cell are implicit 
+    vtkm::cont::CellSetSingleType<> cell_set(topo_name.c_str());
 
-    cell_set.Fill(nverts, shapes, num_indices, connectivity);
+    cell_set.Fill(nverts, shape_id, indices, connectivity);
     
     result->AddCellSet(cell_set);
     
@@ -722,38 +1229,40 @@ VTKHDataAdapter::AddField(const std::string &field_name,
     
     // TODO: how do we deal with vector valued fields?, these will be mcarrays
     
-    const float64 *values_ptr = n_field["values"].as_float64_ptr();
-    string assoc              = n_field["association"].as_string();
+    const Node &n_vals = n_field["values"];
+    string assoc       = n_field["association"].as_string();
 
     try
     {
-        if(assoc == "vertex")
+        // vtk-h casts fields using vtk-m's default type list, which has
+        // uint8, int32, int64, float32 and float64 values. compact values 
+        // of these types are wrapped w/o a copy, other types (e.g. int8 
+        // or uint32) are converted to float64
+        const DataType &dtype = n_vals.dtype();
+        if(dtype.is_float32())
         {
-            //This is the method for zero copy
-            vtkm::cont::ArrayHandle<vtkm::Float64> vtkm_arr = vtkm::cont::make_ArrayHandle(values_ptr, nverts);
-            dset->AddField(vtkm::cont::Field(field_name.c_str(),
-                                             vtkm::cont::Field::ASSOC_POINTS,
-                                             vtkm_arr));
+            detail::AddFieldArray<vtkm::Float32>(field_name, n_vals, assoc,
+                                                 topo_name, neles, nverts, dset);
         }
-        else if( assoc == "element")
+        else if(dtype.is_uint8())
         {
-            // double minv = 1e24;
-            // double maxv = -minv;
-            // for(int i = 0; i < neles; ++i)
-            // {
-            //     double v = values_ptr[i];
-            //     minv = std::min(minv,v);
-            //     maxv= std::max(maxv,v);
-            // }
-            //
-            // std::cout<<"Min "<<minv<<" max "<<maxv<<"\n";
-            
-            //This is the method for zero copy
-            vtkm::cont::ArrayHandle<vtkm::Float64> vtkm_arr = vtkm::cont::make_ArrayHandle(values_ptr, neles);
-            dset->AddField(vtkm::cont::Field(field_name.c_str(),
-                                             vtkm::cont::Field::ASSOC_CELL_SET,
-                                             topo_name.c_str(),
-                                             vtkm_arr));
+            detail::AddFieldArray<vtkm::UInt8>(field_name, n_vals, assoc,
+                                               topo_name, neles, nverts, dset);
+        }
+        else if(dtype.is_int32())
+        {
+            detail::AddFieldArray<vtkm::Int32>(field_name, n_vals, assoc,
+                                               topo_name, neles, nverts, dset);
+        }
+        else if(dtype.is_int64())
+        {
+            detail::AddFieldArray<vtkm::Int64>(field_name, n_vals, assoc,
+                                               topo_name, neles, nverts, dset);
+        }
+        else
+        {
+            detail::AddFieldArray<vtkm::Float64>(field_name, n_vals, assoc,
+                                                 topo_name, neles, nverts, dset);
         }
     }
     catch (vtkm::cont::Error error)
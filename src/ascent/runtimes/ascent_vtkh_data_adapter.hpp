@@ -73,6 +73,9 @@ class DataSet;
 // conduit includes
 #include <conduit.hpp>
 
+#include <set>
+#include <string>
+
 
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
@@ -95,8 +98,16 @@ public:
     //
     //  conduit::blueprint::mesh::verify(n,info) == true
     //
+    // "n" may be a single domain or a multi-domain mesh (one child per
+    // domain). domains use their state/domain_id when present, and are 
+    // converted concurrently on up to num_threads threads.
+    //
+    // if field_names is given, only the listed fields are converted
+    //
     static vtkh::DataSet  *BlueprintToVTKHDataSet(const conduit::Node &n,
-                                                  const std::string &topo_name="");
+                                                  const std::string &topo_name="",
+                                                  const std::set<std::string> *field_names=NULL,
+                                                  int num_threads=1);
 
 
     // convert blueprint data to a vtkm Data Set
@@ -104,8 +115,11 @@ public:
     //
     //  conduit::blueprint::mesh::verify(n,info) == true
     //
+    // if field_names is given, only the listed fields are converted
+    //
     static vtkm::cont::DataSet  *BlueprintToVTKmDataSet(const conduit::Node &n,
-                                                        const std::string &topo_name="");
+                                                        const std::string &topo_name="",
+                                                        const std::set<std::string> *field_names=NULL);
 
 
     // wraps a single VTKm data set into a VTKH dataset
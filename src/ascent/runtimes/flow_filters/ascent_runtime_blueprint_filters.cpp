@@ -116,6 +116,7 @@ BlueprintVerify::declare_interface(Node &i)
     i["type_name"]   = "blueprint_verify";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["generations"] = "forward";
 }
 
 //-----------------------------------------------------------------------------
@@ -294,6 +294,8 @@ RelayIOSave::declare_interface(Node &i)
     i["type_name"]   = "relay_io_save";
     i["port_names"].append() = "in";
     i["output_port"] = "false";
+    // mpi case uses collectives to setup output dirs
+    i["concurrent"]  = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -51,6 +51,12 @@
 
 #include "ascent_runtime_vtkh_filters.hpp"
 
+//-----------------------------------------------------------------------------
+// standard lib includes
+//-----------------------------------------------------------------------------
+#include <algorithm>
+#include <iterator>
+
 //-----------------------------------------------------------------------------
 // thirdparty includes
 //-----------------------------------------------------------------------------
@@ -289,6 +295,44 @@ vtkh::Render parse_render(const conduit::Node &render_node,
   return render;
 }
 
+//-----------------------------------------------------------------------------
+// estimates the bytes held by a vtk-h data set, used to account for 
+// cached filter outputs. fields and coords are counted as FloatDefault 
+// values, and cells as (up to) 8 point ids.
+//-----------------------------------------------------------------------------
+index_t
+dataset_bytes(vtkh::DataSet &data)
+{
+  index_t res = 0;
+  const vtkm::Id num_domains = data.GetNumberOfDomains();
+  for(vtkm::Id i = 0; i < num_domains; ++i)
+  {
+    vtkm::cont::DataSet dom;
+    vtkm::Id domain_id;
+    data.GetDomain(i, dom, domain_id);
+
+    for(vtkm::IdComponent f = 0; f < dom.GetNumberOfFields(); ++f)
+    {
+      const vtkm::cont::DynamicArrayHandle &field = dom.GetField(f).GetData();
+      res += field.GetNumberOfValues() * 
+             field.GetNumberOfComponents() *
+             sizeof(vtkm::FloatDefault);
+    }
+
+    for(vtkm::IdComponent c = 0; c < dom.GetNumberOfCoordinateSystems(); ++c)
+    {
+      res += dom.GetCoordinateSystem(c).GetData().GetNumberOfValues() *
+             3 * sizeof(vtkm::FloatDefault);
+    }
+
+    for(vtkm::IdComponent c = 0; c < dom.GetNumberOfCellSets(); ++c)
+    {
+      res += dom.GetCellSet(c).GetNumberOfCells() * 8 * sizeof(vtkm::Id);
+    }
+  }
+  return res;
+}
+
 //-----------------------------------------------------------------------------
 };
 //-----------------------------------------------------------------------------
@@ -315,6 +359,13 @@ EnsureVTKH::declare_interface(Node &i)
     i["type_name"]   = "ensure_vtkh";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    // same data, in vtk-h form
+    i["generations"] = "forward";
+    // optional params:
+    //  "topology": name of the topology to convert (default: the first)
+    //  "fields":   list of the fields to convert (default: all)
+    //  "threads":  max number of threads used to convert domains 
+    //              (default: 1)
 }
 
 //-----------------------------------------------------------------------------
@@ -325,7 +376,38 @@ EnsureVTKH::execute()
     {
         // convert from blueprint to vtk-h
         const Node *n_input = input<Node>(0);
-        vtkh::DataSet *res = VTKHDataAdapter::BlueprintToVTKHDataSet(*n_input);
+
+        std::string topo_name = "";
+        if(params().has_child("topology"))
+        {
+            topo_name = params()["topology"].as_string();
+        }
+
+        int num_threads = 1;
+        if(params().has_child("threads"))
+        {
+            num_threads = params()["threads"].to_int();
+        }
+
+        // w/o a list of fields, all fields are converted
+        std::set<std::string> field_names;
+        const std::set<std::string> *field_names_ptr = NULL;
+        if(params().has_child("fields"))
+        {
+            NodeConstIterator itr = params()["fields"].children();
+            while(itr.has_next())
+            {
+                field_names.insert(itr.next().as_string());
+            }
+            field_names_ptr = &field_names;
+        }
+
+        vtkh::DataSet *res = 
+            VTKHDataAdapter::BlueprintToVTKHDataSet(*n_input,
+                                                    topo_name,
+                                                    field_names_ptr,
+                                                    num_threads);
+
         set_output<vtkh::DataSet>(res);
 
     }
@@ -369,6 +451,8 @@ VTKHVolumeTracer::declare_interface(Node &i)
     i["port_names"].append() = "in";
     i["port_names"].append() = "renders";
     i["output_port"] = "true";
+    // compositing uses mpi collectives
+    i["concurrent"]  = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -448,6 +532,8 @@ VTKHRayTracer::declare_interface(Node &i)
     i["port_names"].append() = "in";
     i["port_names"].append() = "renders";
     i["output_port"] = "true";
+    // compositing uses mpi collectives
+    i["concurrent"]  = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -531,6 +617,9 @@ VTKHMarchingCubes::declare_interface(Node &i)
     i["type_name"]   = "vtkh_marchingcubes";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    // the contour interpolates all input fields, so it depends
+    // on the whole input
+    i["cacheable"]   = "true";
 }
 
 //-----------------------------------------------------------------------------
@@ -591,6 +680,13 @@ VTKHMarchingCubes::execute()
     set_output<vtkh::DataSet>(iso_output);
 }
 
+//-----------------------------------------------------------------------------
+index_t
+VTKHMarchingCubes::output_bytes()
+{
+    return detail::dataset_bytes(*output<vtkh::DataSet>());
+}
+
 //-----------------------------------------------------------------------------
 VTKHThreshold::VTKHThreshold()
 :Filter()
@@ -611,6 +707,7 @@ VTKHThreshold::declare_interface(Node &i)
     i["type_name"]   = "vtkh_threshold";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["mergeable"]   = "true";
 }
 
 //-----------------------------------------------------------------------------
@@ -730,15 +827,13 @@ DefaultRender::execute()
       ASCENT_ERROR("'a' input must be a vktm::Bounds * instance");
     }
     
-    if(!input(1).check_type<std::set<vtkm::Id> >())
+    if(!input(1).check_type<std::vector<vtkm::Id> >())
     {
-        ASCENT_ERROR("'b' must be a std::set<vtkm::Id> * instance");
+        ASCENT_ERROR("'b' must be a std::vector<vtkm::Id> * instance");
     }
 
     vtkm::Bounds *bounds = input<vtkm::Bounds>(0);
-    std::set<vtkm::Id> *domain_ids = input<std::set<vtkm::Id>>(1);
-    std::vector<vtkm::Id> v_domain_ids(domain_ids->size());
-    std::copy(domain_ids->begin(), domain_ids->end(), v_domain_ids.begin()); 
+    std::vector<vtkm::Id> &v_domain_ids = *input<std::vector<vtkm::Id> >(1);
 
     std::vector<vtkh::Render> *renders = new std::vector<vtkh::Render>();
 
@@ -803,6 +898,7 @@ VTKHClip::declare_interface(Node &i)
     i["type_name"] = "vtkh_clip";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["cacheable"] = "true";
 }
 
 //-----------------------------------------------------------------------------
@@ -864,6 +960,13 @@ VTKHClip::execute()
     set_output<vtkh::DataSet>(clip_output);
 }
 
+//-----------------------------------------------------------------------------
+index_t
+VTKHClip::output_bytes()
+{
+    return detail::dataset_bytes(*output<vtkh::DataSet>());
+}
+
 
 //-----------------------------------------------------------------------------
 EnsureVTKM::EnsureVTKM()
@@ -885,6 +988,7 @@ EnsureVTKM::declare_interface(Node &i)
     i["type_name"]   = "ensure_vtkm";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["generations"] = "forward";
 }
 
 
@@ -934,6 +1038,17 @@ VTKHBounds::declare_interface(Node &i)
     i["type_name"] = "vtkh_bounds";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    // global bounds use mpi collectives, which must run on all ranks, 
+    // so bounds are not cached (cache state differs across ranks)
+    i["concurrent"] = "false";
+    i["mergeable"]  = "true";
+}
+
+//-----------------------------------------------------------------------------
+index_t
+VTKHBounds::output_bytes()
+{
+    return sizeof(vtkm::Bounds);
 }
 
 
@@ -977,6 +1092,7 @@ VTKHUnionBounds::declare_interface(Node &i)
     i["port_names"].append() = "a";
     i["port_names"].append() = "b";
     i["output_port"] = "true";
+    i["mergeable"]   = "true";
 }
 
 
@@ -1001,7 +1117,7 @@ VTKHUnionBounds::execute()
     
 
     result->Include(*bounds_a);
-    result->Include(*bounds_a);
+    result->Include(*bounds_b);
     
     set_output<vtkm::Bounds>(result);
 }
@@ -1028,6 +1144,7 @@ VTKHDomainIds::declare_interface(Node &i)
     i["type_name"] = "vtkh_domain_ids";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["mergeable"]   = "true";
 }
 
 
@@ -1044,12 +1161,13 @@ VTKHDomainIds::execute()
     
     vtkh::DataSet *data = input<vtkh::DataSet>(0);
     
-    std::vector<vtkm::Id> domain_ids = data->GetDomainIds();
-
-    std::set<vtkm::Id> *result = new std::set<vtkm::Id>;
-    result->insert(domain_ids.begin(), domain_ids.end());
+    // domain ids are passed as sorted vectors w/o duplicates
+    std::vector<vtkm::Id> *result = new std::vector<vtkm::Id>(data->GetDomainIds());
+    std::sort(result->begin(), result->end());
+    result->erase(std::unique(result->begin(), result->end()),
+                  result->end());
 
-    set_output<std::set<vtkm::Id> >(result);
+    set_output<std::vector<vtkm::Id> >(result);
 }
 
 
@@ -1075,32 +1193,34 @@ VTKHUnionDomainIds::declare_interface(Node &i)
     i["port_names"].append() = "a";
     i["port_names"].append() = "b";
     i["output_port"] = "true";
+    i["mergeable"]   = "true";
 }
 
 //-----------------------------------------------------------------------------
 void 
 VTKHUnionDomainIds::execute()
 {
-    if(!input(0).check_type<std::set<vtkm::Id> >())
+    if(!input(0).check_type<std::vector<vtkm::Id> >())
     {
-        ASCENT_ERROR("'a' must be a std::set<vtkm::Id> * instance");
+        ASCENT_ERROR("'a' must be a std::vector<vtkm::Id> * instance");
     }
 
-    if(!input(1).check_type<std::set<vtkm::Id> >())
+    if(!input(1).check_type<std::vector<vtkm::Id> >())
     {
-        ASCENT_ERROR("'b' must be a std::set<vtkm::Id> * instance");
+        ASCENT_ERROR("'b' must be a std::vector<vtkm::Id> * instance");
     }
 
+    std::vector<vtkm::Id> *dids_a = input<std::vector<vtkm::Id> >(0);
+    std::vector<vtkm::Id> *dids_b = input<std::vector<vtkm::Id> >(1);
 
-    std::set<vtkm::Id> *dids_a = input<std::set<vtkm::Id>>(0);
-    std::set<vtkm::Id> *dids_b = input<std::set<vtkm::Id>>(1);
-
-    std::set<vtkm::Id> *result = new std::set<vtkm::Id>;
-    *result = *dids_a;
+    // both inputs are sorted, merge them in one pass
+    std::vector<vtkm::Id> *result = new std::vector<vtkm::Id>;
+    result->reserve(dids_a->size() + dids_b->size());
+    std::set_union(dids_a->begin(), dids_a->end(),
+                   dids_b->begin(), dids_b->end(),
+                   std::back_inserter(*result));
     
-    result->insert(dids_b->begin(), dids_b->end());
-    
-    set_output<std::set<vtkm::Id>>(result);
+    set_output<std::vector<vtkm::Id> >(result);
 }
 
 //-----------------------------------------------------------------------------
@@ -1139,6 +1259,8 @@ Scene::declare_interface(Node &i)
     i["port_names"].append() = "bounds";
     i["port_names"].append() = "domain_ids";
     i["output_port"] = "true";
+    // uses a shared image counter
+    i["concurrent"] = "false";
 }
 
 //-----------------------------------------------------------------------------
@@ -1147,9 +1269,9 @@ Scene::execute()
 {
     ASCENT_INFO("Creating a scene default renderer!");
     
-    // inputs are bounds and set of domains
+    // inputs are bounds and sorted domain ids
     vtkm::Bounds       *bounds_in     = input<vtkm::Bounds>(0);
-    std::set<vtkm::Id> *domain_ids_set = input<std::set<vtkm::Id> >(1);
+    std::vector<vtkm::Id> *domain_ids_in = input<std::vector<vtkm::Id> >(1);
     
     std::stringstream ss;
     ss<<"default_image_"<<s_image_count;
@@ -1158,14 +1280,10 @@ Scene::execute()
     vtkm::Bounds bounds;
     bounds.Include(*bounds_in);
     
-    std::vector<vtkm::Id> domain_ids(domain_ids_set->begin(),
-                                     domain_ids_set->end());
-
-    
     vtkh::Render render = vtkh::MakeRender<vtkh::RayTracer>(1024,
                                                             1024, 
                                                             bounds,
-                                                            domain_ids,
+                                                            *domain_ids_in,
                                                             ss.str());
 
     std::vector<vtkh::Render> *renders = new std::vector<vtkh::Render>();
@@ -140,6 +140,7 @@ public:
     virtual bool   verify_params(const conduit::Node &params,
                                  conduit::Node &info);
     virtual void   execute();
+    virtual conduit::index_t output_bytes();
 };
 
 //-----------------------------------------------------------------------------
@@ -166,6 +167,7 @@ public:
     virtual bool   verify_params(const conduit::Node &params,
                                  conduit::Node &info);
     virtual void   execute();
+    virtual conduit::index_t output_bytes();
 };
 
 //-----------------------------------------------------------------------------
@@ -192,6 +194,7 @@ public:
     
     virtual void   declare_interface(conduit::Node &i);
     virtual void   execute();
+    virtual conduit::index_t output_bytes();
 };
 
 //-----------------------------------------------------------------------------
@@ -49,19 +49,24 @@
 //-----------------------------------------------------------------------------
 
 #include "ascent_block_timer.hpp"
+#include "ascent_logging.hpp"
 #include <climits>
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
-#include <time.h>
-#include <sys/time.h>
 #include <sys/types.h>
 #include <unistd.h>
-#include <set>
+#include <vector>
 #include <map>
+#include <set>
+#include <algorithm>
 #include <fstream>
+#include <sstream>
+#include <chrono>
+#include <mutex>
+#include <atomic>
 #ifdef ASCENT_PLATFORM_UNIX
 #include <sys/sysinfo.h>
 #endif
@@ -71,9 +76,7 @@
 using namespace conduit;
 
 #ifdef PARALLEL
-#include "conduit_relay_mpi.hpp"
 #include <mpi.h>
-using namespace conduit::relay::mpi;
 #endif
 
 
@@ -85,396 +88,888 @@ namespace ascent
 {
 
 // Initialize BlockTimer static data members.
-int                             BlockTimer::s_global_depth = 0;
 conduit::Node                   BlockTimer::s_global_root;
-std::string                     BlockTimer::s_current_path = "";
-std::map<std::string, timeval>  BlockTimer::s_timers;
-std::set<std::string>           BlockTimer::s_visited;
-int                             BlockTimer::s_rank = 0;
+int                             BlockTimer::s_rank = -1;
+std::atomic<bool>               BlockTimer::s_trace_enabled(false);
+std::string                     BlockTimer::s_trace_file = "ascent_trace.json";
 
 //-----------------------------------------------------------------------------
-BlockTimer::BlockTimer(std::string const &name)
-: m_name(name)
+// -- begin ascent::detail --
+//-----------------------------------------------------------------------------
+namespace detail
 {
-  Start(name);
-}
+
+typedef std::chrono::steady_clock   timer_clock;
 
 //-----------------------------------------------------------------------------
-void
-BlockTimer::StartTimer(const char *name)
+// one entry in the timer hierarchy, identified by its position in the
+// slot table. children are looked up by name from their parent, so
+// starting a timer that was seen before never allocates.
+//-----------------------------------------------------------------------------
+struct TimerSlot
 {
-  std::string s_name(name);
-  Start(s_name);
-}
+    std::string             name;
+    int                     parent;
+    std::vector<int>        children;
+    timer_clock::time_point start;
+    double                  total;
+    uint32                  count;
+    // sums of the memory readings taken at each stop
+    double                  sys_mem;
+    double                  proc_mem;
+};
+
 //-----------------------------------------------------------------------------
-void
-BlockTimer::StopTimer(const char *name)
+// a completed timer block, in microseconds relative to the trace origin
+//-----------------------------------------------------------------------------
+struct TraceEvent
 {
-  std::string s_name(name);
-  Stop(s_name);
+    std::string name;
+    long long   ts;
+    long long   dur;
+};
+
+//-----------------------------------------------------------------------------
+// timer state of a single thread. each thread only touches its own state,
+// the states of all threads are merged when the timers are finalized.
+//-----------------------------------------------------------------------------
+struct TimerState
+{
+    // small, stable thread id (chrome traces group events by tid)
+    int                     tid;
+    // slot 0 is the (unnamed) root
+    std::vector<TimerSlot>  slots;
+    // slots of the currently open timers, the root is always at the bottom
+    std::vector<int>        stack;
+
+    // trace events and the trace start times of the open blocks
+    std::vector<TraceEvent> events;
+    std::vector<long long>  trace_starts;
+
+    // memory is sampled at most once per interval and the last reading
+    // is attributed to every timer that stops in between
+    timer_clock::time_point mem_sample_time;
+    bool                    mem_sample_valid;
+    uint64                  mem_sys_mb;
+    int                     mem_proc_mb;
+
+    TimerState(int id)
+    : tid(id),
+      mem_sample_valid(false),
+      mem_sys_mb(0),
+      mem_proc_mb(0)
+    {
+        slots.reserve(64);
+        stack.reserve(32);
+        add_slot("",-1);
+        stack.push_back(0);
+    }
+
+    int add_slot(const std::string &name, int parent)
+    {
+        int idx = (int)slots.size();
+        slots.push_back(TimerSlot());
+        TimerSlot &s = slots.back();
+        s.name     = name;
+        s.parent   = parent;
+        s.total    = 0.0;
+        s.count    = 0;
+        s.sys_mem  = 0.0;
+        s.proc_mem = 0.0;
+        if(parent >= 0)
+        {
+            slots[parent].children.push_back(idx);
+        }
+        return idx;
+    }
+
+    int child(int parent, const std::string &name)
+    {
+        const std::vector<int> &children = slots[parent].children;
+        for(size_t i = 0; i < children.size(); i++)
+        {
+            if(slots[children[i]].name == name)
+            {
+                return children[i];
+            }
+        }
+        return add_slot(name,parent);
+    }
+};
+
+// states of all threads that used a timer, they live until exit so
+// timers from finished (or pooled) threads are still reported
+static std::mutex                               states_mutex;
+static std::vector<TimerState*>                 states;
+static thread_local TimerState                 *this_thread_state = NULL;
+
+static std::atomic<double>                      mem_sample_interval(0.1);
+static timer_clock::time_point                  trace_origin;
+
+//-----------------------------------------------------------------------------
+TimerState &
+thread_state()
+{
+    if(this_thread_state == NULL)
+    {
+        std::lock_guard<std::mutex> lock(states_mutex);
+        this_thread_state = new TimerState((int)states.size());
+        states.push_back(this_thread_state);
+    }
+    return *this_thread_state;
 }
+
 //-----------------------------------------------------------------------------
 int
-parseLine(char *line)
+parse_line(char *line)
 {
     int i = strlen(line);
     while (*line < '0' || *line > '9')
     {
         line++;
     }
-    
+
     line[i-3] = '\0';
     i = atoi(line);
-    
+
     return i;
 }
 
 //-----------------------------------------------------------------------------
 void
-BlockTimer::Start(const std::string &name)
+sample_memory(TimerState &state,
+              const timer_clock::time_point &now)
 {
-#ifdef PARALLEL
-    MPI_Comm_rank(MPI_COMM_WORLD, &s_rank);
-    MPI_Barrier(MPI_COMM_WORLD);
-#else
-    s_rank = 0;
-#endif
-    
-    ++s_global_depth;
-
-    if (s_global_depth <= MAX_DEPTH)
+    double interval = mem_sample_interval.load();
+    if(interval < 0.0)
     {
-        s_current_path += "children/" + name + "/";
-        Precheck();
+        return;
+    }
 
-        // Start timing.
-        if (s_timers.count(name) == 0)
-        {
-            timeval timer;
-            s_timers.insert(std::pair<std::string, timeval>(name, timer));
-        }
-        gettimeofday(&s_timers[name], NULL);
+    if(state.mem_sample_valid &&
+       std::chrono::duration<double>(now - state.mem_sample_time).count()
+            < interval)
+    {
+        return;
     }
 
-}
-//-----------------------------------------------------------------------------
-void
-BlockTimer::Stop(const std::string &name)
-{
-#ifdef PARALLEL
-    //MPI_Barrier(MPI_COMM_WORLD);
-#endif
-    if (s_global_depth <= MAX_DEPTH)
-    {
-        // Record timer.
-        timeval start, end;
-        gettimeofday(&end, NULL);
-        start = s_timers[name];
-
-        // Calculate elapsed time.
-        double elapsed_time = (double)(end.tv_sec - start.tv_sec) + ((double)(end.tv_usec - start.tv_usec))/1000000;
-
-        Node &curr = CurrentNode();
-
-        // Update time spent at current location. added after max (changed)
-        double newval = curr["value"].as_float64() + elapsed_time;
-        
-        curr["value"] = newval;
-        curr["min"]   = newval;
-        curr["avg"]   = newval;
-
-        //increment the counter
-        unsigned int count = curr["count"].as_uint32() + 1;
-        curr["count"] = count;
-       
-        // 
-        // Get system memory info and average
-        //
-
-        // Get memory info
+    state.mem_sample_time  = now;
+    state.mem_sample_valid = true;
+
 #ifdef ASCENT_PLATFORM_UNIX
-        struct sysinfo system_info;
-        sysinfo(&system_info);
-        long long memUsed = (system_info.totalram -system_info.freeram);
-        memUsed *= system_info.mem_unit;
-        memUsed = memUsed / 1024 / 1024;
-        unsigned int cSysMem = curr["sysMemUsed"].as_uint64();
-        
-        cSysMem = ((cSysMem * (count - 1) + memUsed) )/ count;
-        curr["sysMemUsed"] = uint64(cSysMem);
-        
-        // 
-        // Get process memory usage and average
-        //
-        FILE* file = fopen("/proc/self/status", "r");
-        int kb = -1;
+    // system memory in use
+    struct sysinfo system_info;
+    sysinfo(&system_info);
+    long long mem_used = (system_info.totalram - system_info.freeram);
+    mem_used *= system_info.mem_unit;
+    state.mem_sys_mb = (uint64)(mem_used / 1024 / 1024);
+
+    // process resident set size
+    FILE* file = fopen("/proc/self/status", "r");
+    int kb = -1;
+    if(file != NULL)
+    {
         char line[128];
         while (fgets(line, 128, file) != NULL)
         {
             if (strncmp(line, "VmRSS:", 6) == 0)
             {
-                kb = parseLine(line);
+                kb = parse_line(line);
                 break;
             }
         }
         fclose(file);
-        
-        kb = kb / 1024;
-        
-        int cProcUsage = curr["procMemMB"].as_int32();
-        cProcUsage = ((cProcUsage * (count - 1) + kb ))  / count;
-        curr["procMemMB"] = cProcUsage;
-
-#else
-        curr["sysMemUsed"] = 0;
-        curr["procMemMB"]  = 0;
-#endif
-        GoUp();
     }
-    
-    // Update current location.
-    --s_global_depth;
-
+    state.mem_proc_mb = kb / 1024;
+#endif
 }
+
 //-----------------------------------------------------------------------------
-BlockTimer::~BlockTimer()
+long long
+trace_time(const timer_clock::time_point &t)
 {
-  Stop(m_name);
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+                t - trace_origin).count();
 }
 
 //-----------------------------------------------------------------------------
-Node &
-BlockTimer::Finalize()
+std::string
+json_escape(const std::string &str)
 {
-    BlockTimer::ReduceGlobalRoot();
-    return GlobalRoot();
+    std::string res;
+    for(size_t i = 0; i < str.size(); i++)
+    {
+        char c = str[i];
+        if(c == '"' || c == '\\')
+        {
+            res += '\\';
+            res += c;
+        }
+        else if((unsigned char)c < 0x20)
+        {
+            res += ' ';
+        }
+        else
+        {
+            res += c;
+        }
+    }
+    return res;
 }
 
+//-----------------------------------------------------------------------------
+// json text for this rank's events, each entry followed by a ",\n"
+//-----------------------------------------------------------------------------
+std::string
+trace_events_json(int rank)
+{
+    std::ostringstream oss;
+    oss << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank
+        << ",\"args\":{\"name\":\"rank " << rank << "\"}},\n";
+    oss << "{\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":" << rank
+        << ",\"args\":{\"sort_index\":" << rank << "}},\n";
+
+    std::lock_guard<std::mutex> lock(states_mutex);
+    for(size_t t = 0; t < states.size(); t++)
+    {
+        const TimerState &state = *states[t];
+        for(size_t i = 0; i < state.events.size(); i++)
+        {
+            const TraceEvent &e = state.events[i];
+            oss << "{\"name\":\"" << json_escape(e.name) << "\""
+                << ",\"ph\":\"X\""
+                << ",\"pid\":" << rank
+                << ",\"tid\":" << state.tid
+                << ",\"ts\":"  << e.ts
+                << ",\"dur\":" << e.dur << "},\n";
+        }
+    }
+    return oss.str();
+}
 
 //-----------------------------------------------------------------------------
-Node &
-BlockTimer::CurrentNode()
+// accumulates slot src_idx of src (and its children) into slot dst_idx of dst
+//-----------------------------------------------------------------------------
+void
+merge_slots(TimerState &dst,
+            int dst_idx,
+            const TimerState &src,
+            int src_idx)
 {
-    return s_global_root[s_current_path];
+    const TimerSlot &s = src.slots[src_idx];
+    {
+        TimerSlot &d = dst.slots[dst_idx];
+        d.total    += s.total;
+        d.count    += s.count;
+        d.sys_mem  += s.sys_mem;
+        d.proc_mem += s.proc_mem;
+    }
+
+    for(size_t i = 0; i < s.children.size(); i++)
+    {
+        const std::string &name = src.slots[s.children[i]].name;
+        merge_slots(dst, dst.child(dst_idx,name), src, s.children[i]);
+    }
 }
 
 //-----------------------------------------------------------------------------
-// Initializes values if the current location hasn't been s_visited yet,
-// and updates the set of s_visited locations.
+// statistics of one timer, reduced across ranks as a fixed size record
 //-----------------------------------------------------------------------------
-void BlockTimer::Precheck()
+enum TimerStat
 {
-    if (s_visited.count(s_current_path + "value") == 0)
-    { // != "" is to prevent a root of ""
-        Node &curr= CurrentNode();
-        curr["value"]      = 0.0;
-        curr["id"]         = s_rank;
-        curr["count"]      = 0u;
-        // added after max (the following 3)
-        curr["min"]        = 0.0;
-        curr["minid"]      = s_rank;
-        curr["avg"]        = 0.0;
-        curr["sysMemUsed"] = 0ul;
-        curr["procMemMB"]  = 0;
+    STAT_MIN = 0,
+    STAT_MIN_RANK,
+    STAT_MAX,
+    STAT_MAX_RANK,
+    STAT_SUM,
+    STAT_SUM_SQ,
+    STAT_RANKS,     // number of ranks that ran the timer, 0 if none
+    STAT_COUNT,
+    STAT_SYS_MEM,
+    STAT_PROC_MEM,
+    STAT_SIZE
+};
 
-        s_visited.insert(s_current_path + "value");
+// sorted timer paths that define the layout of the reduction, the same
+// on all ranks. it only grows, so it is rarely rebuilt.
+static std::vector<std::string>                 reduce_layout;
+
+//-----------------------------------------------------------------------------
+// maps the "/" separated path of every timer below idx to its slot
+//-----------------------------------------------------------------------------
+void
+collect_paths(const TimerState &state,
+              int idx,
+              const std::string &prefix,
+              std::map<std::string,int> &paths)
+{
+    const std::vector<int> &children = state.slots[idx].children;
+    for(size_t i = 0; i < children.size(); i++)
+    {
+        const std::string &name = state.slots[children[i]].name;
+        std::string path = prefix.empty() ? name : prefix + "/" + name;
+        paths[path] = children[i];
+        collect_paths(state, children[i], path, paths);
     }
 }
 
 //-----------------------------------------------------------------------------
-bool
-BlockTimer::CheckForKnownPath(std::string &path)
-{
-  if(path == "value")       return true;
-  if(path == "id")          return true;
-  if(path == "count")       return true;
-  if(path == "avg")         return true;
-  if(path == "minimum")     return true;
-  if(path == "minid")       return true;
-  if(path == "sysMemUsed")  return true;
-  if(path == "procMemMB")   return true;
-  return false;
+void
+init_stats(const TimerSlot &s,
+           int rank,
+           double *stats)
+{
+    stats[STAT_MIN]      = s.total;
+    stats[STAT_MIN_RANK] = rank;
+    stats[STAT_MAX]      = s.total;
+    stats[STAT_MAX_RANK] = rank;
+    stats[STAT_SUM]      = s.total;
+    stats[STAT_SUM_SQ]   = s.total * s.total;
+    stats[STAT_RANKS]    = 1.0;
+    stats[STAT_COUNT]    = s.count;
+    stats[STAT_SYS_MEM]  = s.count > 0 ? s.sys_mem  / s.count : 0.0;
+    stats[STAT_PROC_MEM] = s.count > 0 ? s.proc_mem / s.count : 0.0;
 }
+
 //-----------------------------------------------------------------------------
-// Goes up one function in the current location path.
+// combines the stats in a into b, ties go to the lower rank
 //-----------------------------------------------------------------------------
 void
-BlockTimer::GoUp()
+combine_stats(const double *a,
+              double *b)
 {
-    const unsigned int len = s_current_path.length();
-    if (len == 0)
+    if(a[STAT_RANKS] == 0.0)
     {
-        s_current_path = "";
         return;
     }
-    
-    unsigned int ctr = 1;
-    unsigned int numslashes = 0;
-  
-    std::string::iterator striter = s_current_path.end();
-    --striter;
 
-    while (ctr < len)
+    if(b[STAT_RANKS] == 0.0)
     {
-        if (*striter == '/')
+        for(int i = 0; i < STAT_SIZE; i++)
         {
-            numslashes += 1;
-            if (numslashes >= 3)
-            {
-                s_current_path = s_current_path.substr(0, len - ctr + 1);
-                return;
-            }
+            b[i] = a[i];
         }
-        
-        --striter;
-        ++ctr;
+        return;
+    }
+
+    if(a[STAT_MIN] < b[STAT_MIN] ||
+       (a[STAT_MIN] == b[STAT_MIN] && a[STAT_MIN_RANK] < b[STAT_MIN_RANK]))
+    {
+        b[STAT_MIN]      = a[STAT_MIN];
+        b[STAT_MIN_RANK] = a[STAT_MIN_RANK];
+    }
+
+    if(a[STAT_MAX] > b[STAT_MAX] ||
+       (a[STAT_MAX] == b[STAT_MAX] && a[STAT_MAX_RANK] < b[STAT_MAX_RANK]))
+    {
+        b[STAT_MAX]      = a[STAT_MAX];
+        b[STAT_MAX_RANK] = a[STAT_MAX_RANK];
+    }
+
+    b[STAT_SUM]      += a[STAT_SUM];
+    b[STAT_SUM_SQ]   += a[STAT_SUM_SQ];
+    b[STAT_RANKS]    += a[STAT_RANKS];
+    b[STAT_COUNT]    += a[STAT_COUNT];
+    b[STAT_SYS_MEM]  += a[STAT_SYS_MEM];
+    b[STAT_PROC_MEM] += a[STAT_PROC_MEM];
+}
+
+//-----------------------------------------------------------------------------
+// writes the summary entry for one timer, using the layout of ascent.log
+//-----------------------------------------------------------------------------
+void
+stats_to_node(const double *stats,
+              Node &n)
+{
+    double ranks = stats[STAT_RANKS];
+    double mean  = stats[STAT_SUM] / ranks;
+    double var   = stats[STAT_SUM_SQ] / ranks - mean * mean;
+
+    n["value"]      = stats[STAT_MAX];
+    n["id"]         = (int)stats[STAT_MAX_RANK];
+    n["min"]        = stats[STAT_MIN];
+    n["minid"]      = (int)stats[STAT_MIN_RANK];
+    n["avg"]        = mean;
+    n["stddev"]     = var > 0.0 ? sqrt(var) : 0.0;
+    // max / mean, 1 is perfectly balanced
+    n["imbalance"]  = mean > 0.0 ? stats[STAT_MAX] / mean : 1.0;
+    n["ranks"]      = (int)ranks;
+    n["count"]      = (uint32)(stats[STAT_COUNT] / ranks + 0.5);
+    n["sysMemUsed"] = (uint64)(stats[STAT_SYS_MEM] / ranks);
+    n["procMemMB"]  = (int)(stats[STAT_PROC_MEM] / ranks);
+}
+
+#ifdef PARALLEL
+//-----------------------------------------------------------------------------
+// MPI_User_function for arrays of timer stat records
+//-----------------------------------------------------------------------------
+void
+reduce_stats_op(void *in,
+                void *inout,
+                int *len,
+                MPI_Datatype *)
+{
+    const double *a = static_cast<const double*>(in);
+    double       *b = static_cast<double*>(inout);
+    for(int i = 0; i < *len; i++)
+    {
+        combine_stats(a + i * STAT_SIZE, b + i * STAT_SIZE);
     }
-    
-    s_current_path = "";
-    return;
 }
 
 //-----------------------------------------------------------------------------
-void 
-//-----------------------------------------------------------------------------
-BlockTimer::Reduce(Node &a, Node &b)
-{
-    // If a has it
-    if (a.dtype().is_object() && a.has_path("value")) 
-    {
-      // Update (reduce) data
-      a["count"] = a["count"].as_uint32() + b["count"].as_uint32();
-      
-      if (b["value"].as_float64() > a["value"].as_float64())
-      {
-          a["value"] = b["value"];
-          a["id"] = b["id"];
-      }
-      
-      // added after max
-      if (a["min"].as_float64() > b["min"].as_float64())
-      {
-          a["min"] = b["min"];
-          a["minid"] = b["minid"];
-      }
-      
-      unsigned int count_a = a["count"].as_uint32();
-      unsigned int count_b = b["count"].as_uint32();
-      a["avg"] = (a["avg"].as_float64() * count_a + b["avg"].as_float64() * count_b) / (count_a + count_b);
-    }
-  
-    NodeIterator itr_b(&b);
-
-    while(itr_b.has_next())
-    {
-        itr_b.next();
-        std::string bpath = itr_b.name();
-        //
-        // If we don't know the path then
-        // it is a timer that needs processing 
-        //
-        if(CheckForKnownPath(bpath))
+// makes sure all ranks share a layout that covers every local timer.
+// this costs a single small allreduce unless some rank has a new timer,
+// in which case rank 0 builds the union of all timer paths.
+//-----------------------------------------------------------------------------
+void
+update_layout(const std::map<std::string,int> &paths,
+              int rank,
+              int num_ranks,
+              MPI_Comm comm)
+{
+    int covered = 1;
+    std::map<std::string,int>::const_iterator itr;
+    for(itr = paths.begin(); itr != paths.end() && covered; ++itr)
+    {
+        if(!std::binary_search(reduce_layout.begin(),
+                               reduce_layout.end(),
+                               itr->first))
         {
-            continue;
+            covered = 0;
+        }
+    }
+
+    int all_covered = 0;
+    MPI_Allreduce(&covered, &all_covered, 1, MPI_INT, MPI_MIN, comm);
+    if(all_covered)
+    {
+        return;
+    }
+
+    // gather the local timer paths to rank 0
+    std::string local_paths;
+    for(itr = paths.begin(); itr != paths.end(); ++itr)
+    {
+        local_paths += itr->first + "\n";
+    }
+
+    int local_size = (int)local_paths.size();
+    std::vector<int> sizes(num_ranks,0);
+    MPI_Gather(&local_size, 1, MPI_INT,
+               &sizes[0], 1, MPI_INT,
+               0, comm);
+
+    std::vector<int> offsets(num_ranks,0);
+    int total_size = 0;
+    for(int i = 0; i < num_ranks; i++)
+    {
+        offsets[i]  = total_size;
+        total_size += sizes[i];
+    }
+
+    std::vector<char> all_paths(total_size + 1,0);
+    MPI_Gatherv(const_cast<char*>(local_paths.data()), local_size, MPI_CHAR,
+                &all_paths[0], &sizes[0], &offsets[0], MPI_CHAR,
+                0, comm);
+
+    std::string layout_text;
+    if(rank == 0)
+    {
+        std::set<std::string> layout(reduce_layout.begin(),
+                                     reduce_layout.end());
+        std::istringstream iss(std::string(&all_paths[0],total_size));
+        std::string path;
+        while(std::getline(iss,path))
+        {
+            layout.insert(path);
         }
-        
-        if (a.dtype().is_object() &&  a.has_path(bpath))
+
+        std::set<std::string>::const_iterator litr;
+        for(litr = layout.begin(); litr != layout.end(); ++litr)
         {
-            Reduce(a[bpath], b[bpath]);
+            layout_text += *litr + "\n";
         }
     }
 
-    return;
+    // and share the union with everyone
+    int layout_size = (int)layout_text.size();
+    MPI_Bcast(&layout_size, 1, MPI_INT, 0, comm);
+
+    std::vector<char> layout_buff(layout_size + 1,0);
+    if(rank == 0)
+    {
+        memcpy(&layout_buff[0], layout_text.data(), layout_size);
+    }
+    MPI_Bcast(&layout_buff[0], layout_size, MPI_CHAR, 0, comm);
+
+    reduce_layout.clear();
+    std::istringstream iss(std::string(&layout_buff[0],layout_size));
+    std::string path;
+    while(std::getline(iss,path))
+    {
+        reduce_layout.push_back(path);
+    }
+}
+#endif
+
+};
+//-----------------------------------------------------------------------------
+// -- end ascent::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+BlockTimer::BlockTimer(std::string const &name)
+: m_name(name)
+{
+  Start(name);
+}
+
+//-----------------------------------------------------------------------------
+void
+BlockTimer::StartTimer(const char *name)
+{
+  std::string s_name(name);
+  Start(s_name);
+}
+//-----------------------------------------------------------------------------
+void
+BlockTimer::StopTimer(const char *name)
+{
+  std::string s_name(name);
+  Stop(s_name);
+}
+
+//-----------------------------------------------------------------------------
+void
+BlockTimer::Start(const std::string &name)
+{
+    detail::TimerState &state = detail::thread_state();
+
+    int idx = state.child(state.stack.back(), name);
+    state.stack.push_back(idx);
+
+    // read the clock last, so the bookkeeping above is not timed
+    detail::timer_clock::time_point now = detail::timer_clock::now();
+    state.slots[idx].start = now;
+
+    if(s_trace_enabled)
+    {
+        state.trace_starts.push_back(detail::trace_time(now));
+    }
 }
 //-----------------------------------------------------------------------------
-void 
-BlockTimer::AverageByCount(Node &node, int numRanks)
+void
+BlockTimer::Stop(const std::string &name)
 {
-    if(node.dtype().is_object() && node.has_path("value"))
+    // read the clock first, so the bookkeeping below is not timed
+    detail::timer_clock::time_point now = detail::timer_clock::now();
+
+    detail::TimerState &state = detail::thread_state();
+
+    // ignore a stop without a matching start
+    if(state.stack.size() < 2)
     {
-        double count  = node["count"].as_uint32()  / numRanks;
-        node["value"] = node["value"].as_float64() / count;
-        node["min"]   = node["min"].as_float64()   / count;
-        node["avg"]   = node["avg"].as_float64()   / count;
-        node["count"] = uint32(count);
+        return;
     }
-  
-  
-    NodeIterator itr = node.children();
 
-    while(itr.has_next()) 
+    detail::TimerSlot &s = state.slots[state.stack.back()];
+
+    // ignore a stop that does not match the innermost open timer, so it
+    // does not close (and charge the time to) the wrong block.
+    // (not a warning, this runs in ~BlockTimer and warnings may throw)
+    if(s.name != name)
     {
-        Node &curr_node = itr.next();
-        std::string curr_path = itr.name();
+        ASCENT_INFO("BlockTimer: ignoring stop of '" << name << "'"
+                    << ", the innermost open timer is '" << s.name << "'");
+        return;
+    }
 
-        if(CheckForKnownPath(curr_path))
-        {
-            continue;
-        }
-        
-        AverageByCount(curr_node, numRanks);
+    state.stack.pop_back();
+
+    // blocks opened before the trace was enabled are not recorded
+    if(s_trace_enabled && !state.trace_starts.empty())
+    {
+        detail::TraceEvent e;
+        e.name = name;
+        e.ts   = state.trace_starts.back();
+        e.dur  = detail::trace_time(now) - e.ts;
+        state.trace_starts.pop_back();
+        state.events.push_back(e);
     }
 
-    return;
+    s.total += std::chrono::duration<double>(now - s.start).count();
+    s.count++;
+
+    detail::sample_memory(state,now);
+    s.sys_mem  += (double)state.mem_sys_mb;
+    s.proc_mem += (double)state.mem_proc_mb;
+}
+//-----------------------------------------------------------------------------
+BlockTimer::~BlockTimer()
+{
+  Stop(m_name);
 }
 
 //-----------------------------------------------------------------------------
-void 
-BlockTimer::ReduceAll(Node &thisRanksNode)
+Node &
+BlockTimer::Finalize()
 {
-#ifdef PARALLEL
-    int temp;
-    MPI_Comm_size(MPI_COMM_WORLD, &temp);
-    const unsigned int numProcesses = temp;
-    MPI_Comm_rank(MPI_COMM_WORLD, &temp);
-    const unsigned int rank = temp;
+    BlockTimer::ReduceGlobalRoot();
+    if(s_trace_enabled)
+    {
+        WriteTraceFile();
+    }
+    return GlobalRoot();
+}
 
-    std::vector<Node> recvNodes(numProcesses+1);
+//-----------------------------------------------------------------------------
+void
+BlockTimer::SetMemorySampleInterval(double seconds)
+{
+    detail::mem_sample_interval = seconds;
+}
+
+//-----------------------------------------------------------------------------
+double
+BlockTimer::MemorySampleInterval()
+{
+    return detail::mem_sample_interval;
+}
 
-    if (rank == 0)
+//-----------------------------------------------------------------------------
+void
+BlockTimer::EnableTrace(const std::string &file_name)
+{
+    if(s_trace_enabled)
     {
-        for (unsigned int i = 1; i < numProcesses; ++i)
-        {
-          recv(recvNodes[i], // node
-               i, // source
-               42, // tag
-               MPI_COMM_WORLD // comm
-               );
-           }
-     }
-     else 
-     { 
-         send(thisRanksNode, // node
-              0, // dest
-              42, // tag
-              MPI_COMM_WORLD // comm
-              );
-    }
-
-    if (rank == 0)
-    {
-        for (unsigned int i = 1; i < numProcesses; ++i)
+        s_trace_file = file_name;
+        return;
+    }
+
+#ifdef PARALLEL
+    // line up the trace origins so rank timelines are comparable
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    detail::trace_origin = detail::timer_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(detail::states_mutex);
+        for(size_t i = 0; i < detail::states.size(); i++)
         {
-            Reduce(thisRanksNode.fetch("children"),
-                   recvNodes[i].fetch("children"));
+            detail::states[i]->events.clear();
+            detail::states[i]->trace_starts.clear();
         }
     }
-  
-    // Get the average time per iteration
+    s_trace_file    = file_name;
+    s_trace_enabled = true;
+}
+
+//-----------------------------------------------------------------------------
+void
+BlockTimer::DisableTrace()
+{
+    s_trace_enabled = false;
+
+    std::lock_guard<std::mutex> lock(detail::states_mutex);
+    for(size_t i = 0; i < detail::states.size(); i++)
+    {
+        detail::states[i]->trace_starts.clear();
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool
+BlockTimer::TraceEnabled()
+{
+    return s_trace_enabled;
+}
+
+//-----------------------------------------------------------------------------
+void
+BlockTimer::WriteTraceFile()
+{
+    int rank = Rank();
+
+    std::string events = detail::trace_events_json(rank);
+
+#ifdef PARALLEL
+    int num_ranks = 1;
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+    // gather each rank's event text to rank 0
+    int local_size = (int)events.size();
+    std::vector<int> sizes(num_ranks,0);
+    MPI_Gather(&local_size, 1, MPI_INT,
+               &sizes[0], 1, MPI_INT,
+               0, MPI_COMM_WORLD);
+
+    std::vector<int> offsets(num_ranks,0);
+    int total_size = 0;
+    for(int i = 0; i < num_ranks; i++)
+    {
+        offsets[i]  = total_size;
+        total_size += sizes[i];
+    }
+
+    std::vector<char> all_events(total_size + 1,0);
+    MPI_Gatherv(const_cast<char*>(events.data()), local_size, MPI_CHAR,
+                &all_events[0], &sizes[0], &offsets[0], MPI_CHAR,
+                0, MPI_COMM_WORLD);
+
     if(rank == 0)
     {
-        AverageByCount(s_global_root, numProcesses);
+        events = std::string(&all_events[0],total_size);
+    }
+#endif
+
+    if(rank != 0)
+    {
+        return;
+    }
+
+    // drop the trailing separator
+    if(events.size() >= 2)
+    {
+        events.resize(events.size() - 2);
+    }
+
+    std::ofstream ofs(s_trace_file.c_str());
+    if(!ofs.is_open())
+    {
+        ASCENT_WARN("Failed to open trace file: " << s_trace_file);
+        return;
     }
 
+    ofs << "{\"displayTimeUnit\":\"ms\",\n"
+        << "\"traceEvents\":[\n"
+        << events
+        << "\n]}\n";
+}
+
+//-----------------------------------------------------------------------------
+int
+BlockTimer::Rank()
+{
+    // the rank is looked up once, not on every timer start
+    if(s_rank < 0)
+    {
+#ifdef PARALLEL
+        int mpi_init = 0;
+        MPI_Initialized(&mpi_init);
+        if(!mpi_init)
+        {
+            return 0;
+        }
+        MPI_Comm_rank(MPI_COMM_WORLD, &s_rank);
 #else
-    AverageByCount(BlockTimer::GlobalRoot(),1);
+        s_rank = 0;
 #endif
+    }
+    return s_rank;
 }
 
 //-----------------------------------------------------------------------------
 void BlockTimer::ReduceGlobalRoot()
 {
-    ReduceAll(GlobalRoot());
+    const int rank = Rank();
+
+    // merge the hierarchies of all threads by timer name,
+    // timers started on worker threads show up at the top level
+    detail::TimerState state(-1);
+    {
+        std::lock_guard<std::mutex> lock(detail::states_mutex);
+        for(size_t i = 0; i < detail::states.size(); i++)
+        {
+            detail::merge_slots(state, 0, *detail::states[i], 0);
+        }
+    }
+
+    std::map<std::string,int> paths;
+    detail::collect_paths(state, 0, "", paths);
+
+#ifdef PARALLEL
+    MPI_Comm comm = MPI_COMM_WORLD;
+    int num_ranks = 1;
+    MPI_Comm_size(comm, &num_ranks);
+    detail::update_layout(paths, rank, num_ranks, comm);
+#else
+    detail::reduce_layout.clear();
+    std::map<std::string,int>::const_iterator pitr;
+    for(pitr = paths.begin(); pitr != paths.end(); ++pitr)
+    {
+        detail::reduce_layout.push_back(pitr->first);
+    }
+#endif
+
+    const std::vector<std::string> &layout = detail::reduce_layout;
+    const int num_timers = (int)layout.size();
+    const int stat_size  = detail::STAT_SIZE;
+
+    // fill this rank's records, timers it did not run stay zeroed
+    std::vector<double> local_stats((num_timers + 1) * stat_size, 0.0);
+    for(int i = 0; i < num_timers; i++)
+    {
+        std::map<std::string,int>::const_iterator itr = paths.find(layout[i]);
+        if(itr != paths.end())
+        {
+            detail::init_stats(state.slots[itr->second],
+                               rank,
+                               &local_stats[i * stat_size]);
+        }
+    }
+
+    std::vector<double> stats = local_stats;
+
+#ifdef PARALLEL
+    // a single reduction of all records to rank 0
+    if(num_timers > 0)
+    {
+        MPI_Datatype stat_type;
+        MPI_Type_contiguous(stat_size, MPI_DOUBLE, &stat_type);
+        MPI_Type_commit(&stat_type);
+
+        MPI_Op stat_op;
+        MPI_Op_create(detail::reduce_stats_op, 1, &stat_op);
+
+        MPI_Reduce(&local_stats[0],
+                   &stats[0],
+                   num_timers,
+                   stat_type,
+                   stat_op,
+                   0,
+                   comm);
+
+        MPI_Op_free(&stat_op);
+        MPI_Type_free(&stat_type);
+    }
+
+    // only rank 0 gets the reduced result, other ranks report their own
+    if(rank != 0)
+    {
+        stats = local_stats;
+    }
+#endif
+
+    s_global_root.reset();
+    for(int i = 0; i < num_timers; i++)
+    {
+        const double *timer_stats = &stats[i * stat_size];
+        if(timer_stats[detail::STAT_RANKS] == 0.0)
+        {
+            continue;
+        }
+
+        // "a/b" -> "children/a/children/b"
+        std::string node_path = "children/" + layout[i];
+        size_t pos = node_path.find('/', 9);
+        while(pos != std::string::npos)
+        {
+            node_path.replace(pos, 1, "/children/");
+            pos = node_path.find('/', pos + 10);
+        }
+
+        detail::stats_to_node(timer_stats, s_global_root[node_path]);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -484,11 +979,16 @@ void BlockTimer::WriteLogFile()
 
     std::string logfile = "ascent.log";
     
-    if(s_rank == 0 )
+    if(Rank() == 0 )
     {   
         GlobalRoot().print();
         GlobalRoot().to_json_stream(logfile.c_str(), "json", 2, 5);
     }
+
+    if(s_trace_enabled)
+    {
+        WriteTraceFile();
+    }
 }
 
 //-----------------------------------------------------------------------------
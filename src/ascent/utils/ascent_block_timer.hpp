@@ -52,13 +52,10 @@
 #define ASCENT_BLOCK_TIMER_HPP
 
 #define ASCENT_BLOCK_TIMER(NAME) ascent::BlockTimer ASCENT_BLOCK_TIMER_##NAME(#NAME);
-#define MAX_DEPTH 5
 
-#include<sys/time.h>
 #include <string>
-#include <map>
-#include <set>
 #include <cstdlib>
+#include <atomic>
     
 #include <conduit.hpp>
 #include <ascent_config.h>
@@ -81,6 +78,28 @@ public:
     static conduit::Node &Finalize();
     static void           WriteLogFile();
 
+    // timers are tracked per thread, so they can be used inside openmp
+    // regions and vtk-m worklets. Finalize() merges the hierarchies of
+    // all threads by timer name (timers started on worker threads show
+    // up at the top level) and must be called outside threaded regions.
+
+    // event trace mode: when enabled, every timer start / stop pair is
+    // also recorded as a timestamped event (per rank and per thread).
+    // Finalize() and WriteLogFile() write the events gathered from all
+    // ranks as chrome trace event json (chrome://tracing or Perfetto),
+    // with each mpi rank shown as a separate process.
+    static void           EnableTrace(const std::string &file_name 
+                                        = "ascent_trace.json");
+    static void           DisableTrace();
+    static bool           TraceEnabled();
+    static void           WriteTraceFile();
+
+    // process memory is read at most once per interval (in seconds) and
+    // the last reading is used for the timers that stop in between.
+    // 0 reads on every stop, a negative interval disables memory readings.
+    static void           SetMemorySampleInterval(double seconds);
+    static double         MemorySampleInterval();
+
 private:
     
     static void Start(const std::string &name);
@@ -88,43 +107,19 @@ private:
     static inline conduit::Node &GlobalRoot() 
         {return s_global_root;}
 
+    // reduces the timers of all threads and ranks into s_global_root
     static void ReduceGlobalRoot();
-    
-    // non-static methods
-    
-    // Initializes values if the current location hasn't been visited yet,
-    // and updates the set of visited locations.
-    static void Precheck();
-
-    // Goes up one function in the current location path.
-    static void GoUp();
+    // mpi rank, looked up once
+    static int  Rank();
 
     // non-static data members
     std::string m_name;
 
-    // private static methods
-    static void ReduceAll(conduit::Node &);
-    static conduit::Node &CurrentNode();
-    
-    static void Reduce(conduit::Node &,
-                       conduit::Node &);
-
-    static bool CheckForKnownPath(std::string &);
-
-    static void AverageByCount(conduit::Node &,
-                               int);
-    static void FillDataArray(conduit::Node &,
-                              const int &,
-                              double &,
-                              double [][3],
-                              std::string);
     // static data members 
     static conduit::Node                  s_global_root;
     static int                            s_rank; // MPI rank
-    static int                            s_global_depth;
-    static std::string                    s_current_path;
-    static std::map<std::string, timeval> s_timers;
-    static std::set<std::string>          s_visited;
+    static std::atomic<bool>              s_trace_enabled;
+    static std::string                    s_trace_file;
     
 };
 
@@ -51,6 +51,7 @@
 #define ASCENT_LOGGING_HPP
 
 #include <conduit.hpp>
+#include <flow_logging.hpp>
 
 //-----------------------------------------------------------------------------
 //
@@ -61,8 +62,23 @@
 ///
 /// See conduit::utils docs for details.
 ///
+/// Messages are only constructed if the info logging level is enabled
+/// (see flow::logging). 
+///
+//-----------------------------------------------------------------------------
+#define ASCENT_INFO( msg ) FLOW_INFO( msg );
+
+//-----------------------------------------------------------------------------
+//
+/// The ASCENT_DEBUG macro is used to log detailed diagnostics, such as
+/// dumps of the filter graph and scene descriptions. 
+///
+/// Messages are only constructed when the "verbose" ascent_info option
+/// enables the debug logging level, so it is safe to pass expensive 
+/// expressions (e.g. graph().to_dot()).
+///
 //-----------------------------------------------------------------------------
-#define ASCENT_INFO( msg ) CONDUIT_INFO( msg );
+#define ASCENT_DEBUG( msg ) FLOW_DEBUG( msg );
 
 //-----------------------------------------------------------------------------
 //
@@ -51,6 +51,7 @@
 #include "ascent_png_encoder.hpp"
 
 #include "ascent_logging.hpp"
+#include "ascent_block_timer.hpp"
 
 // standard includes
 #include <stdlib.h>
@@ -84,6 +85,7 @@ PNGEncoder::Encode(const unsigned char *rgba_in,
                    const int width,
                    const int height)
 {
+    ASCENT_BLOCK_TIMER(png_encode);
     Cleanup();
 
     // upside down relative to what lodepng wants
@@ -118,6 +120,7 @@ PNGEncoder::Encode(const float *rgba_in,
                    const int width,
                    const int height)
 {
+    ASCENT_BLOCK_TIMER(png_encode);
     Cleanup();
 
     // upside down relative to what lodepng wants
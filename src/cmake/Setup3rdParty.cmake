@@ -68,6 +68,12 @@ endif()
 ################################
 include(cmake/thirdparty/SetupConduit.cmake)
 
+################################
+# Threads (used by flow's 
+# threaded graph execution)
+################################
+find_package(Threads REQUIRED)
+
 
 ################################################################
 ################################################################
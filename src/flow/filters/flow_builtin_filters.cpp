@@ -100,6 +100,7 @@ Alias::declare_interface(Node &i)
     i["type_name"]   = "alias";
     i["port_names"].append() = "in";
     i["output_port"] = "true";
+    i["generations"] = "forward";
 }
 
 
@@ -131,6 +132,7 @@ RegistrySource::declare_interface(Node &i)
     i["type_name"]   = "registry_source";
     i["port_names"]  = DataType::empty();
     i["output_port"] = "true";
+    i["generations"] = "published";
     i["default_params"]["entry"] = "";
 }
 
@@ -63,8 +63,10 @@
 
 #include <conduit.hpp>
 
+#include <flow_logging.hpp>
 #include <flow_data.hpp>
 #include <flow_registry.hpp>
+#include <flow_cache.hpp>
 #include <flow_filter.hpp>
 #include <flow_graph.hpp>
 #include <flow_workspace.hpp>
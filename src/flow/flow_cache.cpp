@@ -0,0 +1,458 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-716457
+// 
+// All rights reserved.
+// 
+// This file is part of Alpine. 
+// 
+// For details, see: http://software.llnl.gov/alpine/.
+// 
+// Please also read alpine/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: flow_cache.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "flow_cache.hpp"
+
+// standard lib includes
+#include <iostream>
+#include <list>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// flow includes
+//-----------------------------------------------------------------------------
+#include <flow_logging.hpp>
+
+using namespace conduit;
+using namespace std;
+
+//-----------------------------------------------------------------------------
+// -- begin flow:: --
+//-----------------------------------------------------------------------------
+namespace flow
+{
+
+//-----------------------------------------------------------------------------
+//
+// Cache::Map holds the retained outputs, along with a list of their
+// names in use order (least recently used first).
+//
+//-----------------------------------------------------------------------------
+class Cache::Map
+{
+public:
+    struct Item
+    {
+        uint64                          key;
+        Data                           *data;
+        index_t                         bytes;
+        bool                            pinned;
+        std::list<std::string>::iterator use_pos;
+    };
+
+    Map();
+   ~Map();
+
+    Item  *find(const std::string &name);
+    // marks item as most recently used
+    void   touch(Item &item);
+    void   insert(const std::string &name,
+                  uint64 key,
+                  Data &data,
+                  index_t bytes);
+    void   remove(const std::string &name);
+    void   clear();
+
+    void   info(Node &out) const;
+
+    std::mutex                    &mutex();
+
+    index_t                        m_max_bytes;
+    index_t                        m_bytes;
+    index_t                        m_hits;
+    index_t                        m_misses;
+    index_t                        m_evictions;
+
+    std::map<std::string,Item>     m_items;
+    std::list<std::string>         m_use_order;
+
+private:
+    std::mutex                     m_mutex;
+};
+
+//-----------------------------------------------------------------------------
+Cache::Map::Map()
+: m_max_bytes(-1),
+  m_bytes(0),
+  m_hits(0),
+  m_misses(0),
+  m_evictions(0)
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+Cache::Map::~Map()
+{
+    clear();
+}
+
+//-----------------------------------------------------------------------------
+Cache::Map::Item *
+Cache::Map::find(const std::string &name)
+{
+    std::map<std::string,Item>::iterator itr = m_items.find(name);
+    if(itr == m_items.end())
+    {
+        return NULL;
+    }
+    return &itr->second;
+}
+
+//-----------------------------------------------------------------------------
+void
+Cache::Map::touch(Item &item)
+{
+    m_use_order.splice(m_use_order.end(), m_use_order, item.use_pos);
+}
+
+//-----------------------------------------------------------------------------
+void
+Cache::Map::insert(const std::string &name,
+                   uint64 key,
+                   Data &data,
+                   index_t bytes)
+{
+    Item &item   = m_items[name];
+    item.key     = key;
+    item.data    = data.wrap(data.data_ptr());
+    item.bytes   = bytes;
+    item.pinned  = true;
+    item.use_pos = m_use_order.insert(m_use_order.end(), name);
+    m_bytes += bytes;
+}
+
+//-----------------------------------------------------------------------------
+void
+Cache::Map::remove(const std::string &name)
+{
+    std::map<std::string,Item>::iterator itr = m_items.find(name);
+    if(itr == m_items.end())
+    {
+        return;
+    }
+
+    Item &item = itr->second;
+
+    FLOW_DEBUG("Cache Releasing: " << name);
+
+    item.data->release();
+    delete item.data;
+    m_bytes -= item.bytes;
+    m_use_order.erase(item.use_pos);
+    m_items.erase(itr);
+}
+
+//-----------------------------------------------------------------------------
+void
+Cache::Map::clear()
+{
+    while(!m_use_order.empty())
+    {
+        remove(m_use_order.front());
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Cache::Map::info(Node &out) const
+{
+    out.reset();
+    out["max_bytes"] = m_max_bytes;
+    out["bytes"]     = m_bytes;
+    out["hits"]      = m_hits;
+    out["misses"]    = m_misses;
+    out["evictions"] = m_evictions;
+
+    // entries in use order, least recently used first
+    Node &ents = out["entries"];
+    ents.set(DataType::object());
+
+    std::list<std::string>::const_iterator itr;
+    for(itr = m_use_order.begin(); itr != m_use_order.end(); itr++)
+    {
+        const Item &item = m_items.find(*itr)->second;
+        Node &ent_info = ents[*itr];
+        ent_info["bytes"]  = item.bytes;
+        ent_info["pinned"] = item.pinned ? "true" : "false";
+    }
+}
+
+//-----------------------------------------------------------------------------
+std::mutex &
+Cache::Map::mutex()
+{
+    return m_mutex;
+}
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+Cache::Cache()
+:m_map(NULL)
+{
+    m_map = new Map();
+}
+
+//-----------------------------------------------------------------------------
+Cache::~Cache()
+{
+    delete m_map;
+}
+
+//-----------------------------------------------------------------------------
+void
+Cache::set_max_bytes(index_t max_bytes)
+{
+    if(max_bytes < -1)
+    {
+        CONDUIT_ERROR("flow::Cache max bytes must be >= -1"
+                      " (passed " << max_bytes << ")");
+    }
+
+    std::lock_guard<std::mutex> lock(m_map->mutex());
+    m_map->m_max_bytes = max_bytes;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+Cache::max_bytes() const
+{
+    std::lock_guard<std::mutex> lock(m_map->mutex());
+    return m_map->m_max_bytes;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+Cache::bytes() const
+{
+    std::lock_guard<std::mutex> lock(m_map->mutex());
+    return m_map->m_bytes;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+Cache::number_of_entries() const
+{
+    std::lock_guard<std::mutex> lock(m_map->mutex());
+    return (index_t)m_map->m_items.size();
+}
+
+//-----------------------------------------------------------------------------
+bool
+Cache::pin(const std::string &name,
+           uint64 key)
+{
+    std::lock_guard<std::mutex> lock(m_map->mutex());
+    Map::Item *item = m_map->find(name);
+    if(item == NULL || item->key != key)
+    {
+        return false;
+    }
+
+    item->pinned = true;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+Data *
+Cache::fetch(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(m_map->mutex());
+    Map::Item *item = m_map->find(name);
+    if(item == NULL)
+    {
+        return NULL;
+    }
+
+    m_map->m_hits++;
+    m_map->touch(*item);
+    return item->data;
+}
+
+//-----------------------------------------------------------------------------
+bool
+Cache::store(const std::string &name,
+             uint64 key,
+             Data &data,
+             index_t num_bytes)
+{
+    std::lock_guard<std::mutex> lock(m_map->mutex());
+    m_map->m_misses++;
+    m_map->remove(name);
+
+    if(m_map->m_max_bytes != -1 && num_bytes > m_map->m_max_bytes)
+    {
+        return false;
+    }
+
+    m_map->insert(name, key, data, num_bytes);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+void
+Cache::remove(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(m_map->mutex());
+    m_map->remove(name);
+}
+
+//-----------------------------------------------------------------------------
+void
+Cache::retain_only(const std::set<std::string> &names)
+{
+    std::lock_guard<std::mutex> lock(m_map->mutex());
+
+    std::vector<std::string> to_remove;
+    std::map<std::string,Map::Item>::const_iterator itr;
+    for(itr = m_map->m_items.begin(); itr != m_map->m_items.end(); itr++)
+    {
+        if(names.find(itr->first) == names.end())
+        {
+            to_remove.push_back(itr->first);
+        }
+    }
+
+    for(size_t i = 0; i < to_remove.size(); i++)
+    {
+        m_map->remove(to_remove[i]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Cache::unpin_all()
+{
+    std::lock_guard<std::mutex> lock(m_map->mutex());
+    std::map<std::string,Map::Item>::iterator itr;
+    for(itr = m_map->m_items.begin(); itr != m_map->m_items.end(); itr++)
+    {
+        itr->second.pinned = false;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Cache::trim(const std::function<void(const std::string &,
+                                     Data &)> &on_evict)
+{
+    std::lock_guard<std::mutex> lock(m_map->mutex());
+
+    if(m_map->m_max_bytes == -1)
+    {
+        return;
+    }
+
+    std::list<std::string>::iterator itr = m_map->m_use_order.begin();
+    while(m_map->m_bytes > m_map->m_max_bytes &&
+          itr != m_map->m_use_order.end())
+    {
+        // advance first, remove invalidates the current position
+        std::string name = *itr;
+        itr++;
+
+        Map::Item &item = *m_map->find(name);
+        if(item.pinned)
+        {
+            continue;
+        }
+
+        on_evict(name, *item.data);
+        m_map->remove(name);
+        m_map->m_evictions++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Cache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_map->mutex());
+    m_map->clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+Cache::info(Node &out) const
+{
+    std::lock_guard<std::mutex> lock(m_map->mutex());
+    m_map->info(out);
+}
+
+//-----------------------------------------------------------------------------
+std::string
+Cache::to_json() const
+{
+    Node out;
+    info(out);
+    ostringstream oss;
+    out.to_json_stream(oss);
+    return oss.str();
+}
+
+//-----------------------------------------------------------------------------
+void
+Cache::print() const
+{
+    CONDUIT_INFO(to_json());
+}
+
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end flow:: --
+//-----------------------------------------------------------------------------
+
+
@@ -0,0 +1,163 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-716457
+// 
+// All rights reserved.
+// 
+// This file is part of Alpine. 
+// 
+// For details, see: http://software.llnl.gov/alpine/.
+// 
+// Please also read alpine/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: flow_cache.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef FLOW_CACHE_HPP
+#define FLOW_CACHE_HPP
+
+#include <conduit.hpp>
+
+#include <flow_data.hpp>
+
+#include <set>
+#include <functional>
+
+
+//-----------------------------------------------------------------------------
+// -- begin flow:: --
+//-----------------------------------------------------------------------------
+namespace flow
+{
+
+//-----------------------------------------------------------------------------
+///
+/// Cache retains the outputs of cacheable filters across executes (and 
+/// registry resets), keyed by filter name. Each output is stored with the
+/// key it was created with (see Workspace::execute()), and with its size.
+///
+/// When the outputs exceed the byte budget, the least recently used 
+/// outputs are evicted. Outputs used by the current execute are pinned, 
+/// and are only evicted once unpinned.
+///
+/// Cache methods are guarded by a lock, so filters that execute 
+/// concurrently can safely fetch and store outputs.
+///
+//-----------------------------------------------------------------------------
+class Cache
+{
+public:
+
+    // Creation and Destruction
+    Cache();
+   ~Cache();
+
+    /// sets the max number of bytes held by retained outputs.
+    /// -1 (the default) means no limit, 0 disables the cache.
+    void              set_max_bytes(conduit::index_t max_bytes);
+    conduit::index_t  max_bytes() const;
+
+    /// number of bytes held by retained outputs
+    conduit::index_t  bytes() const;
+    /// number of retained outputs
+    conduit::index_t  number_of_entries() const;
+
+    /// checks if the cache holds an output for name created with key,
+    /// if so pins it so it is not evicted until unpin_all()
+    bool              pin(const std::string &name,
+                          conduit::uint64 key);
+
+    /// returns the output for name, NULL if none.
+    /// counts as a hit, and marks the output as most recently used.
+    Data             *fetch(const std::string &name);
+
+    /// retains data as the (pinned) output for name, replacing any 
+    /// previous output. counts as a miss.
+    /// returns false if data is larger than the budget, in this case 
+    /// the caller keeps ownership of data.
+    bool              store(const std::string &name,
+                            conduit::uint64 key,
+                            Data &data,
+                            conduit::index_t num_bytes);
+
+    /// releases the output for name
+    void              remove(const std::string &name);
+    /// releases any outputs not in names
+    void              retain_only(const std::set<std::string> &names);
+
+    /// unpins all outputs
+    void              unpin_all();
+    /// evicts least recently used unpinned outputs until the cache is
+    /// within budget. on_evict is called for each output before it is
+    /// released.
+    void              trim(const std::function<void(const std::string &,
+                                                    Data &)> &on_evict);
+
+    /// releases all outputs, keeps the hit and miss counts
+    void              clear();
+
+    /// create human understandable tree that describes the state
+    /// of the cache (budget, hits, misses, evictions and entries)
+    void              info(conduit::Node &out) const;
+    /// create json string from info
+    std::string       to_json() const;
+    /// print json version of info
+    void              print() const;
+
+private:
+
+    // internal private class that hides imp from main interface
+    class Map;
+    Map *m_map;
+};
+
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end flow:: --
+//-----------------------------------------------------------------------------
+
+
+#endif
+//-----------------------------------------------------------------------------
+// -- end header ifdef guard
+//-----------------------------------------------------------------------------
+
+
@@ -52,6 +52,8 @@
 #ifndef FLOW_DATA_HPP
 #define FLOW_DATA_HPP
 
+#include <new>
+
 #include <conduit.hpp>
 
 
@@ -92,6 +94,11 @@ public:
     
     // creates a new container for given data
     virtual Data  *wrap(void *data)   = 0;
+    // creates a new container for given data in caller provided storage
+    // (at least sizeof(Data) bytes, aligned for Data). The caller
+    // destroys the result with an explicit ~Data() call, not delete.
+    virtual Data  *wrap(void *data,
+                        void *storage) = 0;
     // actually delete the data
     virtual void            release() = 0;
     
@@ -153,6 +160,13 @@ class DataWrapper: public Data
         return new DataWrapper<T>(data);
     }
 
+    Data *wrap(void *data, void *storage)
+    {
+        static_assert(sizeof(DataWrapper<T>) == sizeof(Data),
+                      "DataWrapper must fit in storage sized for Data");
+        return new(storage) DataWrapper<T>(data);
+    }
+
     virtual void release()
     {
         if(data_ptr() != NULL)
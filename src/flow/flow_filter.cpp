@@ -169,6 +169,62 @@ Filter::output_port() const
     return properties()["interface/output_port"].as_string() == "true";
 }
 
+//-----------------------------------------------------------------------------
+bool
+Filter::concurrent() const
+{
+    const Node &iface = interface();
+    
+    if(!iface.has_child("concurrent"))
+    {
+        return true;
+    }
+
+    return iface["concurrent"].as_string() == "true";
+}
+
+//-----------------------------------------------------------------------------
+bool
+Filter::cacheable() const
+{
+    const Node &iface = interface();
+    
+    if(!iface.has_child("cacheable"))
+    {
+        return false;
+    }
+
+    return iface["cacheable"].as_string() == "true";
+}
+
+//-----------------------------------------------------------------------------
+bool
+Filter::mergeable() const
+{
+    const Node &iface = interface();
+    
+    if(!iface.has_child("mergeable"))
+    {
+        return cacheable();
+    }
+
+    return iface["mergeable"].as_string() == "true";
+}
+
+//-----------------------------------------------------------------------------
+std::string
+Filter::generations() const
+{
+    const Node &iface = interface();
+    
+    if(!iface.has_child("generations"))
+    {
+        return "new";
+    }
+
+    return iface["generations"].as_string();
+}
+
 //-----------------------------------------------------------------------------
 bool
 Filter::has_port(const std::string &port_name) const
@@ -234,6 +290,26 @@ Filter::verify_params(const Node &, // unused: params,
     return true;
 }
 
+//-----------------------------------------------------------------------------
+void
+Filter::declare_dependencies(Node &) // unused: deps
+{
+    // empty: depends on all of the input
+}
+
+//-----------------------------------------------------------------------------
+index_t
+Filter::output_bytes()
+{
+    if(m_out != NULL && m_out->check_type<Node>())
+    {
+        return m_out->value<Node>()->total_bytes_compact();
+    }
+
+    // unknown
+    return -1;
+}
+
 
 //-----------------------------------------------------------------------------
 bool
@@ -272,6 +348,79 @@ Filter::verify_interface(const Node &i,
         }
     }
 
+    if(i.has_child("concurrent"))
+    {
+        if(!i["concurrent"].dtype().is_string() ||
+           (i["concurrent"].as_string() != "true" &&
+            i["concurrent"].as_string() != "false"))
+        {
+            std::string msg = "interface 'concurrent' must be"
+                              " {\"true\" | \"false\"}";
+            info["errors"].append().set(msg);
+            res = false;
+        }
+    }
+
+    if(i.has_child("cacheable"))
+    {
+        if(!i["cacheable"].dtype().is_string() ||
+           (i["cacheable"].as_string() != "true" &&
+            i["cacheable"].as_string() != "false"))
+        {
+            std::string msg = "interface 'cacheable' must be"
+                              " {\"true\" | \"false\"}";
+            info["errors"].append().set(msg);
+            res = false;
+        }
+        else if(i["cacheable"].as_string() == "true" &&
+                ( !i.has_child("output_port") ||
+                  !i["output_port"].dtype().is_string() ||
+                  i["output_port"].as_string() != "true"))
+        {
+            std::string msg = "interface 'cacheable' requires"
+                              " 'output_port' = \"true\"";
+            info["errors"].append().set(msg);
+            res = false;
+        }
+    }
+
+    if(i.has_child("mergeable"))
+    {
+        if(!i["mergeable"].dtype().is_string() ||
+           (i["mergeable"].as_string() != "true" &&
+            i["mergeable"].as_string() != "false"))
+        {
+            std::string msg = "interface 'mergeable' must be"
+                              " {\"true\" | \"false\"}";
+            info["errors"].append().set(msg);
+            res = false;
+        }
+        else if(i["mergeable"].as_string() == "true" &&
+                ( !i.has_child("output_port") ||
+                  !i["output_port"].dtype().is_string() ||
+                  i["output_port"].as_string() != "true"))
+        {
+            std::string msg = "interface 'mergeable' requires"
+                              " 'output_port' = \"true\"";
+            info["errors"].append().set(msg);
+            res = false;
+        }
+    }
+
+    if(i.has_child("generations"))
+    {
+        if(!i["generations"].dtype().is_string() ||
+           (i["generations"].as_string() != "new" &&
+            i["generations"].as_string() != "forward" &&
+            i["generations"].as_string() != "published"))
+        {
+            std::string msg = "interface 'generations' must be"
+                              " {\"new\" | \"forward\" | \"published\"}";
+            info["errors"].append().set(msg);
+            res = false;
+        }
+    }
+
     if(!i.has_child("port_names"))
     {
         std::string msg = "interface missing 'port_names' = [ \"i0\" , ..., \"iN\" ]";
@@ -420,6 +569,23 @@ Filter::port_index_to_name(int idx) const
 }
 
 
+//-----------------------------------------------------------------------------
+int
+Filter::port_name_to_index(const std::string &port_name) const
+{
+    NodeConstIterator itr(&port_names());
+    while(itr.has_next())
+    {
+        if(port_name == itr.next().as_string())
+        {
+            return (int)itr.index();
+        }
+    }
+
+    return -1;
+}
+
+
 //-----------------------------------------------------------------------------
 void
 Filter::reset_inputs_and_output()
@@ -102,6 +102,39 @@ class Graph;
 ///    // inited with a *copy* of the default_params when the filter is
 ///    // added to the filter graph.
 ///    i["default_params"]["inc"].set((int)1);
+///
+///    // Optionally declare if this filter can execute concurrently with
+///    // other filters when the workspace uses more than one thread
+///    // (defaults to "true"). Filters that issue MPI collectives or touch
+///    // shared state should declare "false", the workspace executes
+///    // these on the calling thread in plan order.
+///    i["concurrent"] = {"true" | "false"};
+///
+///    // Optionally declare if the workspace may skip this filter and 
+///    // reuse its previous output when its params and inputs are 
+///    // unchanged since the last execute (defaults to "false").
+///    // The output is kept across executes, so it must not reference
+///    // memory owned by the inputs.
+///    // Whether a cacheable filter runs depends on the local cache, so 
+///    // filters that issue MPI collectives must not be cacheable.
+///    i["cacheable"] = {"true" | "false"};
+///
+///    // Optionally declare if the output only depends on the params and
+///    // inputs, so the graph may merge filters of this type that have
+///    // identical params and inputs (see Graph::merge_common_filters).
+///    // Defaults to the value of "cacheable".
+///    i["mergeable"] = {"true" | "false"};
+///
+///    // Optionally declare how the generation table of the output is
+///    // derived (see Workspace::set_generations, defaults to "new"):
+///    //  "new":       output is new data, that changes when the params
+///    //               or inputs change 
+///    //  "forward":   output is the (first) input in a different form
+///    //               and keeps its generation table (along with a 
+///    //               digest of the params, which may select what
+///    //               is forwarded)
+///    //  "published": output is the data published to the workspace
+///    i["generations"] = {"new" | "forward" | "published"};
 ///  }
 ///
 ///  2) Implement an execute() method:
@@ -126,6 +159,18 @@ class Graph;
 ///
 ///  }
 /// 
+///  3) Cacheable filters can optionally implement declare_dependencies()
+///  to list the parts of their inputs they read, as paths into the 
+///  input generation tables (e.g. "fields/braid" or "coordsets"):
+///
+///  void MyFilter::declare_dependencies(conduit::Node &deps)
+///  {
+///     deps.append() = "fields/" + params()["field"].as_string();
+///  }
+///
+///  and output_bytes() to report the size of their output, which is 
+///  counted against the cache budget (see Cache::set_max_bytes()).
+///
 ///  TODO: talk about optional verify_params()
 /// 
 //-----------------------------------------------------------------------------
@@ -157,6 +202,16 @@ public:
     virtual bool          verify_params(const conduit::Node &params,
                                         conduit::Node &info);
 
+    /// optionally override to list the input generation table entries
+    /// the output depends on (a list of paths). By default the output
+    /// depends on all of the input.
+    virtual void          declare_dependencies(conduit::Node &deps);
+
+    /// optionally override to return the number of bytes held by the 
+    /// output (called after execute()). By default this is known for 
+    /// conduit::Node outputs, other types return -1 (unknown size).
+    virtual conduit::index_t output_bytes();
+
     //-------------------------------------------------------------------------
     // filter interface properties
     //-------------------------------------------------------------------------
@@ -172,12 +227,18 @@ public:
     std::string           type_name()   const;
     const conduit::Node  &port_names()  const;
     bool                  output_port() const;
+    bool                  concurrent()  const;
+    bool                  cacheable()   const;
+    bool                  mergeable()   const;
+    std::string           generations() const;
     
     const conduit::Node  &default_params() const;
 
     int                   number_of_input_ports() const;
     bool                  has_port(const std::string &name) const;
     std::string           port_index_to_name(int idx) const;
+    /// returns -1 if the filter has no input port with the given name
+    int                   port_name_to_index(const std::string &name) const;
 
     std::string           name() const;
     std::string           detailed_name() const;
@@ -56,6 +56,8 @@
 #include <string.h>
 #include <limits.h>
 #include <cstdlib>
+#include <algorithm>
+#include <set>
 
 //-----------------------------------------------------------------------------
 // thirdparty includes
@@ -69,6 +71,7 @@
 // flow includes
 //-----------------------------------------------------------------------------
 #include <flow_workspace.hpp>
+#include <flow_logging.hpp>
 
 
 using namespace conduit;
@@ -87,7 +90,8 @@ namespace flow
 //-----------------------------------------------------------------------------
 Graph::Graph(Workspace *w)
 :m_workspace(w),
- m_filter_count(0)
+ m_filter_count(0),
+ m_version(0)
 {
     
 }
@@ -111,15 +115,19 @@ void
 Graph::reset()
 {
     // delete all filters
-
-    std::map<std::string,Filter*>::iterator itr;
-    for(itr = m_filters.begin(); itr != m_filters.end(); itr++)
+    for(size_t i = 0; i < m_filters.size(); i++)
     {
-        delete itr->second;
+        if(m_filters[i] != NULL)
+        {
+            delete m_filters[i];
+        }
     }
 
     m_filters.clear();
-    m_edges.reset();
+    m_filter_ids.clear();
+    m_inputs.clear();
+    m_outputs.clear();
+    m_version++;
 
 }
 
@@ -166,22 +174,14 @@ Graph::add_filter(const std::string &filter_type,
     }
     
     
-    m_filters[filter_name] = f;
-    
-    NodeConstIterator ports_itr = f->port_names().children();
+    m_filter_ids[filter_name] = (int)m_filters.size();
+    m_filters.push_back(f);
+    // all input ports start out unconnected
+    m_inputs.push_back(std::vector<int>(f->number_of_input_ports(),-1));
+    m_outputs.push_back(std::vector<int>());
 
-    while(ports_itr.has_next())
-    {
-        std::string port_name = ports_itr.next().as_string();
-        m_edges["in"][filter_name][port_name] = DataType::empty();
-    }
-    
-    if(f->output_port())
-    {
-        m_edges["out"][filter_name] = DataType::list();
-    }
-    
     m_filter_count++;
+    m_version++;
     
     return f;
 }
@@ -215,15 +215,18 @@ Graph::connect(const std::string &src_name,
                const std::string &port_name)
 {
     // make sure we have a filter with the given name
+    int src_id = filter_id(src_name);
     
-    if(!has_filter(src_name))
+    if(src_id == -1)
     {
         CONDUIT_WARN("source filter named: " << src_name
                     << " does not exist in Filter Graph");
         return;
     }
 
-    if(!has_filter(des_name))
+    int des_id = filter_id(des_name);
+
+    if(des_id == -1)
     {
         CONDUIT_WARN("destination filter named: " << des_name
                     << " does not exist in Filter Graph");
@@ -231,10 +234,11 @@ Graph::connect(const std::string &src_name,
     }
 
 
-    Filter *des_filter = m_filters[des_name];
+    Filter *des_filter = m_filters[des_id];
+    int port_idx = des_filter->port_name_to_index(port_name);
 
     // make sure it has an input port with the given name
-    if(!des_filter->has_port(port_name))
+    if(port_idx == -1)
     {
         CONDUIT_WARN("destination filter: "
                      << des_filter->detailed_name()
@@ -243,8 +247,19 @@ Graph::connect(const std::string &src_name,
         return;
     }
     
-    m_edges["in"][des_name][port_name] = src_name;
-    m_edges["out"][src_name].append().set(des_name);
+    // if the port was already connected, drop the old edge
+    int prev_src_id = m_inputs[des_id][port_idx];
+    if(prev_src_id != -1)
+    {
+        std::vector<int> &prev_outs = m_outputs[prev_src_id];
+        prev_outs.erase(std::find(prev_outs.begin(),
+                                  prev_outs.end(),
+                                  des_id));
+    }
+
+    m_inputs[des_id][port_idx] = src_id;
+    m_outputs[src_id].push_back(des_id);
+    m_version++;
 }
 
 //-----------------------------------------------------------------------------
@@ -253,14 +268,16 @@ Graph::connect(const std::string &src_name,
                const std::string &des_name,
                int port_idx)
 {
-    if(!has_filter(des_name))
+    int des_id = filter_id(des_name);
+
+    if(des_id == -1)
     {
         CONDUIT_WARN("destination filter named: " << des_name
                     << " does not exist in Filter Graph ");
         return;
     }
 
-    Filter *des_filter = m_filters[des_name];
+    Filter *des_filter = m_filters[des_id];
     std::string port_name = des_filter->port_index_to_name(port_idx);
 
 
@@ -274,15 +291,16 @@ Graph::connect(const std::string &src_name,
 bool
 Graph::has_filter(const std::string &name)
 {
-    std::map<std::string,Filter*>::iterator itr = m_filters.find(name);
-    return itr != m_filters.end();
+    return filter_id(name) != -1;
 }
 
 //-----------------------------------------------------------------------------
 void
 Graph::remove_filter(const std::string &name)
 {
-    if(!has_filter(name))
+    int id = filter_id(name);
+
+    if(id == -1)
     {
         CONDUIT_WARN("filter named: " << name
                      << " does not exist in Filter Graph");
@@ -290,43 +308,180 @@ Graph::remove_filter(const std::string &name)
     }
 
     // remove from m_filters, and prune edges
-    std::map<std::string,Filter*>::iterator itr = m_filters.find(name);
-    
-    delete itr->second;
-    
-    m_filters.erase(itr);
-    
-    m_edges["in"].remove(name);
-    m_edges["out"].remove(name);
+    delete m_filters[id];
+    m_filters[id] = NULL;
+    m_filter_ids.erase(name);
+
+    std::vector<int> &f_inputs = m_inputs[id];
+    for(size_t i = 0; i < f_inputs.size(); i++)
+    {
+        if(f_inputs[i] != -1)
+        {
+            std::vector<int> &src_outs = m_outputs[f_inputs[i]];
+            src_outs.erase(std::find(src_outs.begin(),
+                                     src_outs.end(),
+                                     id));
+        }
+    }
+
+    std::vector<int> &f_outputs = m_outputs[id];
+    for(size_t i = 0; i < f_outputs.size(); i++)
+    {
+        std::vector<int> &des_ins = m_inputs[f_outputs[i]];
+        std::replace(des_ins.begin(), des_ins.end(), id, -1);
+    }
+
+    f_inputs.clear();
+    f_outputs.clear();
+    m_version++;
 }
 
 //-----------------------------------------------------------------------------
-const Node &
-Graph::edges() const
+int
+Graph::merge_common_filters(Node &merged)
 {
-    return m_edges;
+    const int num_ids = number_of_filter_ids();
+
+    // visit filters in topological order, so the inputs of a filter are
+    // already merged when we compare it. ready filters are visited in 
+    // id order, so we keep the duplicate that was added first.
+    std::vector<int> pending(num_ids,0);
+    std::set<int>    ready;
+
+    for(int id = 0; id < num_ids; id++)
+    {
+        if(m_filters[id] == NULL)
+        {
+            continue;
+        }
+
+        const std::vector<int> &f_inputs = m_inputs[id];
+        for(size_t i = 0; i < f_inputs.size(); i++)
+        {
+            if(f_inputs[i] != -1)
+            {
+                pending[id]++;
+            }
+        }
+
+        if(pending[id] == 0)
+        {
+            ready.insert(id);
+        }
+    }
+
+    // type, inputs and params of each kept filter
+    std::map<std::string,int> kept;
+    int num_merged = 0;
+
+    while(!ready.empty())
+    {
+        int id = *ready.begin();
+        ready.erase(ready.begin());
+
+        const std::vector<int> &f_outputs = m_outputs[id];
+        for(size_t i = 0; i < f_outputs.size(); i++)
+        {
+            if(--pending[f_outputs[i]] == 0)
+            {
+                ready.insert(f_outputs[i]);
+            }
+        }
+
+        Filter *f = m_filters[id];
+        const std::vector<int> &f_inputs = m_inputs[id];
+
+        // filters with missing inputs are reported when executed 
+        if(!f->mergeable() ||
+           std::find(f_inputs.begin(), f_inputs.end(), -1) != f_inputs.end())
+        {
+            continue;
+        }
+
+        ostringstream oss;
+        oss << f->type_name() << "\n";
+        for(size_t i = 0; i < f_inputs.size(); i++)
+        {
+            oss << f_inputs[i] << " ";
+        }
+        oss << "\n" << f->params().to_json();
+
+        std::map<std::string,int>::const_iterator itr = kept.find(oss.str());
+        if(itr == kept.end())
+        {
+            kept[oss.str()] = id;
+            continue;
+        }
+
+        // connect the consumers of the duplicate to the kept filter
+        int keep_id = itr->second;
+        std::vector<int> &dup_outs = m_outputs[id];
+        for(size_t i = 0; i < dup_outs.size(); i++)
+        {
+            std::vector<int> &des_ins = m_inputs[dup_outs[i]];
+            std::replace(des_ins.begin(), des_ins.end(), id, keep_id);
+        }
+
+        std::vector<int> &keep_outs = m_outputs[keep_id];
+        keep_outs.insert(keep_outs.end(), dup_outs.begin(), dup_outs.end());
+        dup_outs.clear();
+
+        std::string name = f->name();
+        merged[name] = m_filters[keep_id]->name();
+        remove_filter(name);
+        num_merged++;
+    }
+
+    return num_merged;
+}
+
+//-----------------------------------------------------------------------------
+uint64
+Graph::version() const
+{
+    return m_version;
 }
 
 //-----------------------------------------------------------------------------
-const Node &
-Graph::edges_out(const std::string &f_name) const
+int
+Graph::number_of_filter_ids() const
 {
-    return edges()["out"][f_name];
+    return (int)m_filters.size();
 }
 
 //-----------------------------------------------------------------------------
-const Node &
-Graph::edges_in(const std::string &f_name) const
+Filter *
+Graph::filter(int id) const
 {
-    return edges()["in"][f_name];
+    return m_filters[id];
+}
+
+//-----------------------------------------------------------------------------
+int
+Graph::filter_id(const std::string &name) const
+{
+    std::map<std::string,int>::const_iterator itr = m_filter_ids.find(name);
+    
+    if(itr == m_filter_ids.end())
+    {
+        return -1;
+    }
+
+    return itr->second;
 }
 
+//-----------------------------------------------------------------------------
+const std::vector<int> &
+Graph::inputs(int id) const
+{
+    return m_inputs[id];
+}
 
 //-----------------------------------------------------------------------------
-std::map<std::string,Filter*>  &
-Graph::filters()
+const std::vector<int> &
+Graph::outputs(int id) const
 {
-    return m_filters;
+    return m_outputs[id];
 }
 
 
@@ -335,10 +490,10 @@ void
 Graph::filters(Node &out) const
 {
     out.reset();
-    std::map<std::string,Filter*>::const_iterator itr;
-    for(itr = m_filters.begin(); itr != m_filters.end(); itr++)
+    std::map<std::string,int>::const_iterator itr;
+    for(itr = m_filter_ids.begin(); itr != m_filter_ids.end(); itr++)
     {
-        Filter *f_ptr = itr->second;
+        Filter *f_ptr = m_filters[itr->second];
         Node &f_info = out[itr->first];
         f_info["type_name"] = f_ptr->type_name();
         
@@ -355,23 +510,28 @@ void
 Graph::connections(Node &out) const
 {
     out.reset();
-    NodeConstIterator edges_itr = edges()["in"].children();
-    while(edges_itr.has_next())
+    // filters in the order they were added, ports in port order
+    for(size_t des_id = 0; des_id < m_filters.size(); des_id++)
     {
-        const Node &edge = edges_itr.next();
-        std::string dest_name = edges_itr.name();
-        NodeConstIterator ports_itr = edge.children();
-        while(ports_itr.has_next())
+        Filter *des_filter = m_filters[des_id];
+        
+        if(des_filter == NULL)
+        {
+            continue;
+        }
+
+        std::string dest_name = des_filter->name();
+        const std::vector<int> &des_inputs = m_inputs[des_id];
+
+        for(size_t port_idx = 0; port_idx < des_inputs.size(); port_idx++)
         {
-            const Node &port = ports_itr.next();
-            if(port.dtype().is_string())
+            int src_id = des_inputs[port_idx];
+            if(src_id != -1)
             {
-                std::string port_name = ports_itr.name();
-                std::string src_name  = port.as_string();
                 Node &edge = out.append();
-                edge["src"]  = src_name;
+                edge["src"]  = m_filters[src_id]->name();
                 edge["dest"] = dest_name;
-                edge["port"] = port_name;
+                edge["port"] = des_filter->port_index_to_name((int)port_idx);
             }
         }
     }
@@ -383,7 +543,7 @@ Graph::connections(Node &out) const
 void
 Graph::add_filters(const Node &filters)
 {
-    CONDUIT_INFO(filters.to_json());
+    FLOW_DEBUG(filters.to_json());
 
     NodeConstIterator filters_itr = filters.children();
 
@@ -450,7 +610,7 @@ Graph::add_filters(const Node &filters)
 void
 Graph::add_connections(const Node &conns)
 {
-    CONDUIT_INFO(conns.to_json());
+    FLOW_DEBUG(conns.to_json());
 
     NodeConstIterator conns_itr = conns.children();
     while(conns_itr.has_next())
@@ -52,6 +52,8 @@
 #ifndef FLOW_GRAPH_HPP
 #define FLOW_GRAPH_HPP
 
+#include <vector>
+
 #include <flow_filter.hpp>
 
 
@@ -122,6 +124,19 @@ public:
     /// remove if filter with passed name from this graph
     void remove_filter(const std::string &name);
 
+    /// merge filters that are "mergeable" (see Filter) and have the same
+    /// type, params and inputs. The consumers of each duplicate are 
+    /// connected to the first such filter added to the graph, and the 
+    /// duplicate is removed. For each removed filter, adds an entry to
+    /// merged that maps its name to the name of the filter kept.
+    /// Returns the number of filters removed.
+    int  merge_common_filters(conduit::Node &merged);
+
+    /// returns a counter that is incremented each time the graph
+    /// is modified (add_filter, connect, remove_filter, reset).
+    /// Used by the workspace to reuse execution plans.
+    conduit::uint64 version() const;
+
     /// this methods are used by save() and info()
     /// the produce conduit trees with data that can be used
     /// add_filters() and add_connections().
@@ -188,17 +203,33 @@ public:
 private:
     Graph(Workspace *w);
 
-    const conduit::Node &edges()  const;
-    const conduit::Node &edges_in(const std::string &f_name)  const;
-    const conduit::Node &edges_out(const std::string &f_name) const;
-
-    std::map<std::string,Filter*> &filters();
-
+    // Filters are identified internally by dense integer ids, assigned 
+    // in the order they are added. Ids of removed filters are not reused
+    // until the graph is reset, their slots hold NULL.
+
+    /// size of the id space (including removed filters)
+    int                      number_of_filter_ids() const;
+    /// returns NULL if the filter with the given id was removed
+    Filter                  *filter(int id) const;
+    /// returns -1 if there is no filter with the given name
+    int                      filter_id(const std::string &name) const;
+    /// source filter id for each input port of the given filter 
+    /// (by port index), -1 for unconnected ports
+    const std::vector<int>  &inputs(int id) const;
+    /// destination filter ids of the given filter's output,
+    /// one entry per connection
+    const std::vector<int>  &outputs(int id) const;
 
     Workspace                       *m_workspace;
-    conduit::Node                    m_edges;
-    std::map<std::string,Filter*>    m_filters;
+    // filters by id
+    std::vector<Filter*>             m_filters;
+    // name to id lookup, also provides the sorted name order 
+    std::map<std::string,int>        m_filter_ids;
+    // adjacency by id
+    std::vector<std::vector<int> >   m_inputs;
+    std::vector<std::vector<int> >   m_outputs;
     int                              m_filter_count;
+    conduit::uint64                  m_version;
 
 };
 
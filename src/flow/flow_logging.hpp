@@ -0,0 +1,149 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-716457
+// 
+// All rights reserved.
+// 
+// This file is part of Alpine. 
+// 
+// For details, see: http://software.llnl.gov/alpine/.
+// 
+// Please also read alpine/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: flow_logging.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef FLOW_LOGGING_HPP
+#define FLOW_LOGGING_HPP
+
+#include <conduit.hpp>
+
+//-----------------------------------------------------------------------------
+// -- begin flow:: --
+//-----------------------------------------------------------------------------
+namespace flow
+{
+
+//-----------------------------------------------------------------------------
+// -- begin flow::logging --
+//-----------------------------------------------------------------------------
+namespace logging
+{
+
+//-----------------------------------------------------------------------------
+///
+/// Logging levels, messages are only constructed when their level is
+/// >= the current level:
+///
+///   LEVEL_DEBUG: detailed diagnostics (registry state for each filter
+///                execution, registry releases, graph dumps)
+///   LEVEL_INFO:  basic progress messages (the default)
+///   LEVEL_WARN:  disables debug and info messages
+///
+/// Warnings and errors are always reported.
+///
+//-----------------------------------------------------------------------------
+enum Level
+{
+    LEVEL_DEBUG = 0,
+    LEVEL_INFO  = 1,
+    LEVEL_WARN  = 2
+};
+
+/// set the current logging level
+void set_level(int level);
+/// returns the current logging level
+int  level();
+
+//-----------------------------------------------------------------------------
+// -- begin flow::logging::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+    // read directly by enabled(), so the check is inlined
+    extern int current_level;
+};
+//-----------------------------------------------------------------------------
+// -- end flow::logging::detail --
+//-----------------------------------------------------------------------------
+
+/// check if messages at the given level are enabled
+inline bool enabled(int level)
+{
+    return level >= detail::current_level;
+}
+
+};
+//-----------------------------------------------------------------------------
+// -- end flow::logging --
+//-----------------------------------------------------------------------------
+
+};
+//-----------------------------------------------------------------------------
+// -- end flow:: --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//
+/// The FLOW_DEBUG and FLOW_INFO macros log messages via CONDUIT_INFO, 
+/// when their level is enabled. The message (stream expression) is not 
+/// evaluated when the level is disabled.
+//
+//-----------------------------------------------------------------------------
+#define FLOW_DEBUG( msg )                                                \
+{                                                                        \
+    if(::flow::logging::enabled(::flow::logging::LEVEL_DEBUG))           \
+    {                                                                    \
+        CONDUIT_INFO( msg );                                             \
+    }                                                                    \
+}
+
+#define FLOW_INFO( msg )                                                 \
+{                                                                        \
+    if(::flow::logging::enabled(::flow::logging::LEVEL_INFO))            \
+    {                                                                    \
+        CONDUIT_INFO( msg );                                             \
+    }                                                                    \
+}
+
+
+#endif
+//-----------------------------------------------------------------------------
+// -- end header ifdef guard
+//-----------------------------------------------------------------------------
+
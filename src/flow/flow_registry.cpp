@@ -56,6 +56,16 @@
 #include <string.h>
 #include <limits.h>
 #include <cstdlib>
+#include <mutex>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+
+//-----------------------------------------------------------------------------
+// flow includes
+//-----------------------------------------------------------------------------
+#include <flow_logging.hpp>
 
 using namespace conduit;
 using namespace std;
@@ -75,6 +85,15 @@ namespace flow
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+//
+// The map holds one Entry per key and one Value per tracked pointer. 
+// Both are looked up using open addressing hash tables and live in 
+// slab pools. Entries and values are recycled (not freed) when they are
+// released or when the registry is reset, so once a workspace has 
+// executed a cycle the following cycles don't allocate bookkeeping objects.
+//
+//-----------------------------------------------------------------------------
 class Registry::Map
 {
 public:
@@ -104,27 +123,43 @@ public:
     {
         public:
 
-            Value(Data &data, int refs_needed);
+            Value();
             ~Value();
 
-            Data *data();
+            // wraps data (in place) and sets refs needed
+            void           set(Data &data, int refs_needed);
+            // destroys the wrapper, does not release the data
+            void           clear();
+
+            Data          *data();
             Ref           *ref();
  
             void          *data_ptr();
+
+            // number of entries that refer to this value
+            int            entries() const;
+            void           add_entry();
+            int            remove_entry();
  
         private:
             Ref            m_ref;
-            Data *m_data;
+            Data          *m_data;
+            int            m_entries;
+            // storage for the wrapper pointed to by m_data
+            std::aligned_storage<sizeof(Data),
+                                 alignof(Data)>::type m_data_storage;
     };
 
     class Entry
     {
         public:
-                 Entry(Value *, int refs_needed);
+                 Entry();
                  ~Entry();
 
+                 void            set(Value *value, int refs_needed);
+
                  Value          *value();
-                 Data  *data();
+                 Data           *data();
                  Ref            *ref();
 
         private:
@@ -134,6 +169,75 @@ public:
         
     };
 
+    //-------------------------------------------------------------------------
+    // Pool of default constructed objects, allocated in slabs.
+    // Objects handed back to the pool are reused as is, so they should be
+    // reinitialized by the caller.
+    //-------------------------------------------------------------------------
+    template <class T>
+    class Pool
+    {
+        public:
+            Pool();
+           ~Pool();
+
+            T    *acquire();
+            void  recycle(T *obj);
+
+        private:
+            static const int    SLAB_SIZE = 64;
+
+            std::vector<T*>     m_slabs;
+            std::vector<T*>     m_free;
+    };
+
+    //-------------------------------------------------------------------------
+    // Open addressing (linear probing) hash table that maps keys to 
+    // pointers. clear() keeps the slots (and their key storage) for reuse.
+    //-------------------------------------------------------------------------
+    template <class K, class V>
+    class HashTable
+    {
+        public:
+            HashTable();
+           ~HashTable();
+
+            V       *find(const K &key) const;
+            // key must not already be present
+            void     insert(const K &key, V *value);
+            void     erase(const K &key);
+            void     clear();
+
+            size_t   size() const;
+
+            // slot access, for iteration w/o allocation
+            size_t   capacity() const;
+            // returns NULL if the slot is not in use
+            V       *value_at(size_t slot_idx) const;
+
+            // collect entries, sorted by key
+            void     items(std::vector<std::pair<K,V*> > &out) const;
+
+        private:
+            enum SlotState { EMPTY, FULL, REMOVED };
+
+            struct Slot
+            {
+                K          key;
+                V         *value;
+                SlotState  state;
+            };
+
+            // returns the index of the slot holding key, or -1
+            index_t  find_slot(const K &key) const;
+            void     rehash(size_t capacity);
+
+            std::vector<Slot>   m_slots;
+            size_t              m_size;
+            size_t              m_num_removed;
+            std::hash<K>        m_hash;
+    };
+
  
     Map();
    ~Map();
@@ -152,15 +256,25 @@ public:
     void   dec(const std::string &key);
     
     void   detach(const std::string &key);
+
+    void   forget(const std::string &key);
     
     void   info(Node &out) const;
     
     void   reset();
+
+    // guards the map when filters execute concurrently
+    std::recursive_mutex &mutex();
     
 private:
 
-    std::map<void*,Value*>         m_values;
-    std::map<std::string,Entry*>   m_entries;
+    std::recursive_mutex           m_mutex;
+
+    HashTable<void*,Value>         m_values;
+    HashTable<std::string,Entry>   m_entries;
+
+    Pool<Value>                    m_value_pool;
+    Pool<Entry>                    m_entry_pool;
 
 };
 
@@ -248,21 +362,40 @@ Registry::Map::Ref::inc(int amt)
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-Registry::Map::Value::Value(Data &data,
-                            int refs_needed)
-:m_ref(refs_needed),
- m_data(NULL)
+Registry::Map::Value::Value()
+:m_ref(),
+ m_data(NULL),
+ m_entries(0)
 {
-    m_data = data.wrap(data.data_ptr());
+    // empty
 }
 
 //-----------------------------------------------------------------------------
 Registry::Map::Value::~Value()
 {
-    // empty
+    clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+Registry::Map::Value::set(Data &data,
+                          int refs_needed)
+{
+    clear();
+    m_ref.set_pending(refs_needed);
+    m_entries = 0;
+    m_data = data.wrap(data.data_ptr(),&m_data_storage);
+}
+
+//-----------------------------------------------------------------------------
+void
+Registry::Map::Value::clear()
+{
     if(m_data != NULL)
     {
-        delete m_data;
+        // the wrapper lives in m_data_storage
+        m_data->~Data();
+        m_data = NULL;
     }
 }
 
@@ -288,6 +421,31 @@ Registry::Map::Value::ref()
     return &m_ref;
 }
 
+//-----------------------------------------------------------------------------
+int
+Registry::Map::Value::entries() const
+{
+    return m_entries;
+}
+
+//-----------------------------------------------------------------------------
+void
+Registry::Map::Value::add_entry()
+{
+    m_entries++;
+}
+
+//-----------------------------------------------------------------------------
+int
+Registry::Map::Value::remove_entry()
+{
+    if(m_entries > 0)
+    {
+        m_entries--;
+    }
+    return m_entries;
+}
+
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 //
@@ -299,9 +457,9 @@ Registry::Map::Value::ref()
 
 //-----------------------------------------------------------------------------
 
-Registry::Map::Entry::Entry(Value *value, int refs_needed)
-: m_ref(refs_needed),
-  m_value(value)
+Registry::Map::Entry::Entry()
+: m_ref(),
+  m_value(NULL)
 {
     // empty
 }
@@ -312,6 +470,14 @@ Registry::Map::Entry::~Entry()
     // empty
 }
 
+//-----------------------------------------------------------------------------
+void
+Registry::Map::Entry::set(Value *value, int refs_needed)
+{
+    m_ref.set_pending(refs_needed);
+    m_value = value;
+}
+
 //-----------------------------------------------------------------------------
 Registry::Map::Value *
 Registry::Map::Entry::value()
@@ -336,6 +502,264 @@ Registry::Map::Entry::data()
 }
 
 
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//
+// Registry::Map::Pool Class
+//
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template <class T>
+Registry::Map::Pool<T>::Pool()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+template <class T>
+Registry::Map::Pool<T>::~Pool()
+{
+    for(size_t i = 0; i < m_slabs.size(); i++)
+    {
+        delete [] m_slabs[i];
+    }
+}
+
+//-----------------------------------------------------------------------------
+template <class T>
+T *
+Registry::Map::Pool<T>::acquire()
+{
+    if(m_free.empty())
+    {
+        T *slab = new T[SLAB_SIZE];
+        m_slabs.push_back(slab);
+        // hand out in address order
+        for(int i = SLAB_SIZE - 1; i >= 0; i--)
+        {
+            m_free.push_back(&slab[i]);
+        }
+    }
+
+    T *res = m_free.back();
+    m_free.pop_back();
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+template <class T>
+void
+Registry::Map::Pool<T>::recycle(T *obj)
+{
+    m_free.push_back(obj);
+}
+
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//
+// Registry::Map::HashTable Class
+//
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+template <class K, class V>
+Registry::Map::HashTable<K,V>::HashTable()
+: m_size(0),
+  m_num_removed(0)
+{
+    // capacity is always a power of two
+    rehash(64);
+}
+
+//-----------------------------------------------------------------------------
+template <class K, class V>
+Registry::Map::HashTable<K,V>::~HashTable()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+template <class K, class V>
+index_t
+Registry::Map::HashTable<K,V>::find_slot(const K &key) const
+{
+    const size_t mask = m_slots.size() - 1;
+    size_t idx = m_hash(key) & mask;
+
+    // there is always at least one empty slot, so this terminates
+    while(m_slots[idx].state != EMPTY)
+    {
+        if(m_slots[idx].state == FULL && m_slots[idx].key == key)
+        {
+            return (index_t)idx;
+        }
+        idx = (idx + 1) & mask;
+    }
+
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+template <class K, class V>
+V *
+Registry::Map::HashTable<K,V>::find(const K &key) const
+{
+    index_t idx = find_slot(key);
+    
+    if(idx == -1)
+    {
+        return NULL;
+    }
+    
+    return m_slots[idx].value;
+}
+
+//-----------------------------------------------------------------------------
+template <class K, class V>
+void
+Registry::Map::HashTable<K,V>::insert(const K &key, V *value)
+{
+    // keep the load (including removed slots) under 3/4
+    if( (m_size + m_num_removed + 1) * 4 > m_slots.size() * 3)
+    {
+        size_t capacity = m_slots.size();
+        // only grow if removed slots aren't the issue
+        if( (m_size + 1) * 2 > capacity)
+        {
+            capacity *= 2;
+        }
+        rehash(capacity);
+    }
+
+    const size_t mask = m_slots.size() - 1;
+    size_t idx = m_hash(key) & mask;
+
+    while(m_slots[idx].state == FULL)
+    {
+        idx = (idx + 1) & mask;
+    }
+
+    if(m_slots[idx].state == REMOVED)
+    {
+        m_num_removed--;
+    }
+
+    Slot &slot = m_slots[idx];
+    slot.key   = key;
+    slot.value = value;
+    slot.state = FULL;
+    m_size++;
+}
+
+//-----------------------------------------------------------------------------
+template <class K, class V>
+void
+Registry::Map::HashTable<K,V>::erase(const K &key)
+{
+    index_t idx = find_slot(key);
+    
+    if(idx != -1)
+    {
+        m_slots[idx].value = NULL;
+        m_slots[idx].state = REMOVED;
+        m_size--;
+        m_num_removed++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+template <class K, class V>
+void
+Registry::Map::HashTable<K,V>::clear()
+{
+    for(size_t i = 0; i < m_slots.size(); i++)
+    {
+        m_slots[i].value = NULL;
+        m_slots[i].state = EMPTY;
+    }
+
+    m_size        = 0;
+    m_num_removed = 0;
+}
+
+//-----------------------------------------------------------------------------
+template <class K, class V>
+size_t
+Registry::Map::HashTable<K,V>::size() const
+{
+    return m_size;
+}
+
+//-----------------------------------------------------------------------------
+template <class K, class V>
+size_t
+Registry::Map::HashTable<K,V>::capacity() const
+{
+    return m_slots.size();
+}
+
+//-----------------------------------------------------------------------------
+template <class K, class V>
+V *
+Registry::Map::HashTable<K,V>::value_at(size_t slot_idx) const
+{
+    if(m_slots[slot_idx].state != FULL)
+    {
+        return NULL;
+    }
+
+    return m_slots[slot_idx].value;
+}
+
+//-----------------------------------------------------------------------------
+template <class K, class V>
+void
+Registry::Map::HashTable<K,V>::items(std::vector<std::pair<K,V*> > &out) const
+{
+    out.clear();
+    out.reserve(m_size);
+    
+    for(size_t i = 0; i < m_slots.size(); i++)
+    {
+        if(m_slots[i].state == FULL)
+        {
+            out.push_back(std::make_pair(m_slots[i].key,m_slots[i].value));
+        }
+    }
+
+    std::sort(out.begin(),out.end());
+}
+
+//-----------------------------------------------------------------------------
+template <class K, class V>
+void
+Registry::Map::HashTable<K,V>::rehash(size_t capacity)
+{
+    std::vector<Slot> old_slots;
+    old_slots.swap(m_slots);
+
+    Slot empty_slot;
+    empty_slot.key   = K();
+    empty_slot.value = NULL;
+    empty_slot.state = EMPTY;
+    m_slots.resize(capacity,empty_slot);
+
+    m_size        = 0;
+    m_num_removed = 0;
+
+    for(size_t i = 0; i < old_slots.size(); i++)
+    {
+        if(old_slots[i].state == FULL)
+        {
+            insert(old_slots[i].key,old_slots[i].value);
+        }
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
@@ -370,44 +794,43 @@ Registry::Map::add(const std::string &key,
     void *data_ptr = data.data_ptr();
 
     // check if we are already tracking this pointer
-    std::map<void*,Value*>::iterator itr = m_values.find(data_ptr);
-    if( itr != m_values.end() )
+    Value *val = m_values.find(data_ptr);
+    if( val != NULL )
     {
-        Value *val = itr->second;
         // if we are already tracking it, fetch the value and
         // inc the refs needed
         val->ref()->inc(refs_needed);
-
-        // create a new entry assoced with this pointer
-        Entry *ent = new Entry(val,refs_needed);
-        // add to our entries
-        m_entries[key] = ent;
     }
     else
     {
         // if we aren't already tracking it, we can create a
-        // new value and entry
-    
-        Value *val = new Value(data,refs_needed);
-        m_values[data_ptr] = val;
-
-        Entry *ent = new Entry(val,refs_needed);
-        m_entries[key] = ent;
+        // new value
+        val = m_value_pool.acquire();
+        val->set(data,refs_needed);
+        m_values.insert(data_ptr,val);
     }
+
+    val->add_entry();
+
+    // create a new entry assoced with this pointer
+    Entry *ent = m_entry_pool.acquire();
+    ent->set(val,refs_needed);
+    // add to our entries
+    m_entries.insert(key,ent);
 }
 
 //-----------------------------------------------------------------------------
 Registry::Map::Entry *
 Registry::Map::fetch_entry(const std::string &key)
 {
-    return m_entries[key];
+    return m_entries.find(key);
 }
 
 //-----------------------------------------------------------------------------
 Registry::Map::Value *
 Registry::Map::fetch_value(void *data_ptr)
 {
-    return m_values[data_ptr];
+    return m_values.find(data_ptr);
 }
 
 
@@ -415,18 +838,14 @@ Registry::Map::fetch_value(void *data_ptr)
 bool
 Registry::Map::has_entry(const std::string &key)
 {
-    std::map<std::string,Entry*>::const_iterator itr;
-    itr = m_entries.find(key);
-    return itr != m_entries.end();
+    return m_entries.find(key) != NULL;
 }
 
 //-----------------------------------------------------------------------------
 bool
 Registry::Map::has_value(void *data_ptr)
 {
-    std::map<void*,Value*>::const_iterator itr;
-    itr = m_values.find(data_ptr);
-    return itr != m_values.end();
+    return m_values.find(data_ptr) != NULL;
 }
 
 
@@ -442,11 +861,12 @@ Registry::Map::dec(const std::string &key)
     
     if(ent_refs == 0)
     {
-        CONDUIT_INFO("Registry Removing: " << key);
+        FLOW_DEBUG("Registry Removing: " << key);
 
-        // clean up bookkeeping obj
-        delete ent;
+        // recycle bookkeeping obj
         m_entries.erase(key);
+        m_entry_pool.recycle(ent);
+        value->remove_entry();
     }
 
     int val_refs = value->ref()->dec();
@@ -456,19 +876,23 @@ Registry::Map::dec(const std::string &key)
         
         void *data_ptr = value->data_ptr();
         
-        Node rel_info;
-        ostringstream oss;
-        oss << data_ptr;
-        
-        rel_info[oss.str()]["pending"] = value->ref()->pending();
+        if(logging::enabled(logging::LEVEL_DEBUG))
+        {
+            Node rel_info;
+            ostringstream oss;
+            oss << data_ptr;
+            
+            rel_info[oss.str()]["pending"] = value->ref()->pending();
 
-        CONDUIT_INFO("Registry Releasing: " << rel_info.to_json());
+            CONDUIT_INFO("Registry Releasing: " << rel_info.to_json());
+        }
 
         value->data()->release();
                 
-        // clean up bookkeeping obj
-        delete value;
+        // recycle bookkeeping obj
         m_values.erase(data_ptr);
+        value->clear();
+        m_value_pool.recycle(value);
     }
 }
 
@@ -481,15 +905,46 @@ Registry::Map::detach(const std::string &key)
     Entry *ent   = fetch_entry(key);
     Value *value = ent->value();
     
-    CONDUIT_INFO("Registry Removing: " << key);
+    FLOW_DEBUG("Registry Removing: " << key);
 
-    // clean up bookkeeping obj
-    delete ent;
+    // recycle bookkeeping obj
     m_entries.erase(key);
+    m_entry_pool.recycle(ent);
+    value->remove_entry();
     // make sure we don't reap
     value->ref()->set_pending(-1);
 }
 
+//-----------------------------------------------------------------------------
+void
+Registry::Map::forget(const std::string &key)
+{
+    // removes this entry from the map, and the value if no other entry
+    // refers to it, w/o releasing the data
+    Entry *ent   = fetch_entry(key);
+    Value *value = ent->value();
+
+    FLOW_DEBUG("Registry Forgetting: " << key);
+
+    // recycle bookkeeping obj
+    m_entries.erase(key);
+    m_entry_pool.recycle(ent);
+
+    if(value->remove_entry() == 0)
+    {
+        // the address may be reused for other data, don't keep a 
+        // stale value for it
+        m_values.erase(value->data_ptr());
+        value->clear();
+        m_value_pool.recycle(value);
+    }
+    else
+    {
+        // make sure we don't reap
+        value->ref()->set_pending(-1);
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 void
@@ -498,66 +953,75 @@ Registry::Map::info(Node &out) const
     out.reset();
 
     Node &ents = out["entries"];
-    std::map<std::string,Entry*>::const_iterator eitr;
     
-    for(eitr = m_entries.begin(); eitr != m_entries.end(); eitr++)
+    std::vector<std::pair<std::string,Entry*> > ent_items;
+    m_entries.items(ent_items);
+
+    for(size_t i = 0; i < ent_items.size(); i++)
     {
-        Entry *ent = eitr->second;
-        ents[eitr->first]["pending"] = ent->ref()->pending();
-        ent->data()->info(ents[eitr->first]["data"]);
+        Entry *ent = ent_items[i].second;
+        Node &ent_info = ents[ent_items[i].first];
+        ent_info["pending"] = ent->ref()->pending();
+        ent->data()->info(ent_info["data"]);
     }
 
     Node &ptrs = out["pointers"];
 
-    std::map<void*,Value*>::const_iterator vitr;
+    std::vector<std::pair<void*,Value*> > val_items;
+    m_values.items(val_items);
 
     ostringstream oss;
-    for(vitr = m_values.begin(); vitr != m_values.end(); vitr++)
+    for(size_t i = 0; i < val_items.size(); i++)
     {
-        oss << vitr->first;
-        Value *v= vitr->second;
+        oss << val_items[i].first;
+        Value *v = val_items[i].second;
         ptrs[oss.str()]["pending"] = v->ref()->pending();
         oss.str("");
     }
 
 }
 
+//-----------------------------------------------------------------------------
+std::recursive_mutex &
+Registry::Map::mutex()
+{
+    return m_mutex;
+}
+
 //-----------------------------------------------------------------------------
 void
 Registry::Map::reset()
 {
-    // release anything still tracked
-    std::map<void*,Value*>::iterator vitr;
-    for(vitr = m_values.begin(); vitr != m_values.end(); vitr++)
+    // release anything still tracked, and recycle internally 
+    // alloced stuff
+    for(size_t i = 0; i < m_values.capacity(); i++)
     {
-        Value *v = vitr->second;
+        Value *v = m_values.value_at(i);
+        if(v == NULL)
+        {
+            continue;
+        }
+
         if(v->ref()->tracked())
         {
             v->data()->release();
         }
+        v->clear();
+        m_value_pool.recycle(v);
     }
 
+    m_values.clear();
 
-    // clean up internally allcoed stuff
-
-
-    std::map<std::string,Entry*>::iterator eitr;
-    for(eitr = m_entries.begin(); eitr != m_entries.end(); eitr++)
-    {
-        Entry *e = eitr->second;
-        delete e;
-    }
-    m_entries.clear();
-
-    
-    // std::map<void*,Value*>::iterator vitr;
-    for(vitr = m_values.begin(); vitr != m_values.end(); vitr++)
+    for(size_t i = 0; i < m_entries.capacity(); i++)
     {
-        Value *v = vitr->second;
-        delete v;
+        Entry *e = m_entries.value_at(i);
+        if(e != NULL)
+        {
+            m_entry_pool.recycle(e);
+        }
     }
 
-    m_values.clear();
+    m_entries.clear();
 }
 
 
@@ -582,6 +1046,7 @@ Registry::~Registry()
 bool 
 Registry::has_entry(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     return m_map->has_entry(key);
 }
 
@@ -589,6 +1054,7 @@ Registry::has_entry(const std::string &key)
 void
 Registry::consume(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     if(m_map->has_entry(key))
     {
         m_map->dec(key);
@@ -599,6 +1065,7 @@ Registry::consume(const std::string &key)
 void
 Registry::detach(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     if(m_map->has_entry(key))
     {
         m_map->detach(key);
@@ -606,10 +1073,22 @@ Registry::detach(const std::string &key)
 }
 
 
+//-----------------------------------------------------------------------------
+void
+Registry::forget(const std::string &key)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
+    if(m_map->has_entry(key))
+    {
+        m_map->forget(key);
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 Registry::reset()
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     m_map->reset();
 }
 
@@ -618,6 +1097,7 @@ Registry::reset()
 void
 Registry::info(Node &out) const
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     m_map->info(out);
 }
 
@@ -646,6 +1126,7 @@ Registry::print() const
 Data &
 Registry::fetch(const std::string &key)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     if(!m_map->has_entry(key))
     {
         print();
@@ -661,6 +1142,7 @@ Registry::add(const std::string &key,
               Data &data,
               int refs_needed)
 {
+    std::lock_guard<std::recursive_mutex> lock(m_map->mutex());
     if(m_map->has_entry(key))
     {
         CONDUIT_WARN("Attempt to overwrite existing entry with key: " << key);
@@ -115,6 +115,10 @@ namespace flow
 // T * my_data_2 = input(1);
 // life will be managed by the registry
 // output()->set(my_new_data)
+//
+// registry methods are guarded by a lock, so filters that execute
+// concurrently (see Workspace::set_number_of_threads) can safely
+// fetch, add and consume entries.
 
 //-----------------------------------------------------------------------------
 class Registry
@@ -164,6 +168,11 @@ public:
     /// removes entry from that data store w/o releasing data.
     void           detach(const std::string &key);
 
+    /// removes entry from that data store w/o releasing data, and stops
+    /// tracking the data's address if no other entry refers to it.
+    /// (use when another owner takes over the data)
+    void           forget(const std::string &key);
+
     /// clears registry entries and releases any outstanding
     /// tracked data refs.
     void           reset();
@@ -56,6 +56,23 @@
 #include <string.h>
 #include <limits.h>
 #include <cstdlib>
+#include <set>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <chrono>
+#include <algorithm>
+#include <typeinfo>
+
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// flow includes
+//-----------------------------------------------------------------------------
+#include <flow_logging.hpp>
 
 using namespace conduit;
 using namespace std;
@@ -72,22 +89,182 @@ namespace flow
 // we will try this strategy.
 int Workspace::m_default_mpi_comm = -1;
 
+//-----------------------------------------------------------------------------
+//
+// An execution plan holds the graph traversals flattened into plan order, 
+// along with the resolved connections of each filter. Compiling a plan 
+// walks the graph, so the workspace keeps the last compiled plan and only
+// recompiles when the graph's version changes.
+//
 //-----------------------------------------------------------------------------
 class Workspace::ExecutionPlan
 {
     public:
+        ExecutionPlan();
+        ~ExecutionPlan();
 
         static void generate(Graph &g,
                              conduit::Node &traversals);
+
+        // true if this plan was compiled from the current state of g
+        bool        is_current(const Graph &g) const;
+        void        compile(Graph &g);
+
+        int         number_of_filters() const;
+
+        // what to do with each filter during an execute
+        enum Action
+        {
+            RUN,   // execute the filter
+            REUSE, // use the filter's cached output
+            SKIP   // nothing downstream needs the output
+        };
+
+        static std::string action_name(int action);
+
+        // set m_order for this execute
+        void        order_by_plan();
+        void        order_by_memory();
+        // high-water mark of output bytes held in the registry when 
+        // executing in the given order, using m_out_bytes. outputs of 
+        // unknown size count as unknown_bytes.
+        index_t     peak_bytes(const std::vector<int> &order,
+                               index_t unknown_bytes) const;
+        // number of outputs created during the last execute whose size
+        // is unknown
+        int         unknown_bytes_outputs() const;
+
+        // start of each traversal in plan order
+        std::vector<int>                     m_traversals;
+        // graph ids, filters, names, refs needed and concurrency 
+        // in plan order
+        std::vector<int>                     m_ids;
+        std::vector<Filter*>                 m_filters;
+        std::vector<std::string>             m_names;
+        std::vector<int>                     m_urefs;
+        std::vector<bool>                    m_concurrent;
+        std::vector<bool>                    m_cacheable;
+        std::vector<std::string>             m_generations;
+        // input port names and the plan index of the connected 
+        // source for each filter 
+        std::vector<std::vector<std::string> > m_port_names;
+        std::vector<std::vector<int> >         m_inputs;
+        // consumers of each filter (one entry per connected port)
+        std::vector<std::vector<int> >         m_consumers;
+        // true if any filter is cacheable
+        bool                                   m_has_cacheable;
+
+        // per execute state (see Workspace::prepare_execute)
+        std::vector<int>                       m_actions;
+        // cache key, output generation table and its digest
+        std::vector<uint64>                    m_keys;
+        std::vector<Node>                      m_gen_tables;
+        std::vector<uint64>                    m_gen_digests;
+        // plan indices in execution order
+        std::vector<int>                       m_order;
+
+        // output bytes measured during the last execute that ran each
+        // filter, -1 if unknown (kept until the plan is recompiled)
+        std::vector<index_t>                   m_out_bytes;
         
     private:
-        ExecutionPlan();
-        ~ExecutionPlan();
-        
-        static void bf_topo_sort_visit(Graph &graph,
-                                       const std::string &filter_name,
-                                       conduit::Node &tags,
-                                       conduit::Node &tarv);
+        void        bf_topo_sort_visit(Graph &graph,
+                                       int filter_id,
+                                       std::vector<int> &tags,
+                                       std::vector<int> &plan_idxs);
+
+        bool                                 m_compiled;
+        uint64                               m_version;
+};
+
+//-----------------------------------------------------------------------------
+//
+// Executes an execution plan using a pool of threads.
+//
+// Filters are handed to the pool as soon as all of their inputs have been
+// produced, favoring filters that come first in the plan's execution order.
+// Filters that are not safe to run concurrently are executed by the calling
+// thread in execution order, so any MPI collectives they issue happen in
+// the same order on every rank.
+//
+//-----------------------------------------------------------------------------
+class Workspace::Scheduler
+{
+    public:
+        Scheduler(Workspace &w,
+                  ExecutionPlan &plan);
+        ~Scheduler();
+
+        void execute(int num_threads);
+
+    private:
+        void worker();
+        void run(int idx);
+        void complete(int idx);
+
+        Workspace                       &m_workspace;
+        ExecutionPlan                   &m_plan;
+
+        // number of input ports waiting on data for each filter
+        std::vector<int>                 m_pending;
+        // position of each filter in the execution order
+        std::vector<int>                 m_position;
+        // non-concurrent filters, in execution order
+        std::vector<int>                 m_serial;
+        // positions of concurrent filters whose inputs are ready
+        std::set<int>                    m_ready;
+
+        int                              m_num_done;
+        bool                             m_stop;
+        std::exception_ptr               m_error;
+
+        std::mutex                       m_mutex;
+        std::condition_variable          m_cond;
+};
+
+//-----------------------------------------------------------------------------
+//
+// Records per filter timings and outputs during an execute, along with 
+// the high-water mark of filter outputs held in the registry.
+//
+//-----------------------------------------------------------------------------
+class Workspace::Profile
+{
+    public:
+        typedef std::chrono::steady_clock Clock;
+
+        Profile();
+        ~Profile();
+
+        void begin(const ExecutionPlan &plan);
+
+        void set_times(int idx,
+                       const Clock::time_point &t_start,
+                       const Clock::time_point &t_fetched,
+                       const Clock::time_point &t_executed);
+
+        // records the output of a filter, and adds it to the live outputs
+        void set_output(int idx, Data &out, index_t num_bytes);
+
+        void output_added(int idx, index_t num_bytes);
+        void output_released(int idx);
+
+        void end(const ExecutionPlan &plan, conduit::Node &out);
+
+    private:
+        std::vector<double>          m_fetch_times;
+        std::vector<double>          m_exec_times;
+        std::vector<std::string>     m_out_types;
+        std::vector<index_t>         m_out_bytes;
+        std::vector<bool>            m_live;
+
+        index_t                      m_live_entries;
+        index_t                      m_live_bytes;
+        index_t                      m_max_entries;
+        index_t                      m_max_bytes;
+
+        Clock::time_point            m_start;
+        std::mutex                   m_mutex;
 };
 
 //-----------------------------------------------------------------------------
@@ -107,9 +284,103 @@ private:
 //-----------------------------------------------------------------------------
 std::map<std::string,FilterFactoryMethod> Workspace::FilterFactory::m_filter_types;
 
+//-----------------------------------------------------------------------------
+// helpers used to derive cache keys and generation tables
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// readable name of the type held by a data wrapper
+static std::string
+data_type_name(const Data &data)
+{
+    if(data.check_type<Node>())
+    {
+        return "conduit::Node";
+    }
+
+    std::string res = typeid(data).name();
+#if defined(__GNUG__)
+    int status = 0;
+    char *demangled = abi::__cxa_demangle(res.c_str(), NULL, NULL, &status);
+    if(status == 0 && demangled != NULL)
+    {
+        res = demangled;
+    }
+    free(demangled);
+
+    // flow::DataWrapper<T> -> T
+    size_t start = res.find('<');
+    size_t end   = res.rfind('>');
+    if(start != std::string::npos && end != std::string::npos && end > start)
+    {
+        res = res.substr(start + 1, end - start - 1);
+    }
+#endif
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// 64-bit FNV-1a 
+static uint64
+hash_bytes(const void *bytes,
+           size_t num_bytes,
+           uint64 h = 14695981039346656037ULL)
+{
+    const unsigned char *b = static_cast<const unsigned char*>(bytes);
+    for(size_t i = 0; i < num_bytes; i++)
+    {
+        h ^= (uint64)b[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+//-----------------------------------------------------------------------------
+static uint64
+hash_string(const std::string &str)
+{
+    return hash_bytes(str.c_str(), str.size());
+}
+
+//-----------------------------------------------------------------------------
+static uint64
+hash_combine(uint64 h, uint64 v)
+{
+    return hash_bytes(&v, sizeof(uint64), h);
+}
+
+//-----------------------------------------------------------------------------
+// digest of a generation table, covers child names and leaf counters 
+static uint64
+hash_generations(const Node &gens)
+{
+    uint64 h = hash_string(gens.name());
+
+    if(gens.number_of_children() == 0)
+    {
+        if(gens.dtype().is_number())
+        {
+            h = hash_combine(h, gens.to_uint64());
+        }
+        return h;
+    }
+
+    NodeConstIterator itr = gens.children();
+    while(itr.has_next())
+    {
+        h = hash_combine(h, hash_generations(itr.next()));
+    }
+
+    return h;
+}
+
+
 
 //-----------------------------------------------------------------------------
 Workspace::ExecutionPlan::ExecutionPlan()
+: m_has_cacheable(false),
+  m_compiled(false),
+  m_version(0)
 {
     // empty
 }
@@ -128,257 +399,1297 @@ Workspace::ExecutionPlan::generate(Graph &graph,
 {   
     traversals.reset();
 
-    Node snks;
-    Node srcs;
+    ExecutionPlan plan;
+    plan.compile(graph);
 
-    std::map<std::string,Filter*>::iterator itr;
-    
-    for(itr  = graph.m_filters.begin();
-        itr != graph.m_filters.end();
-        itr++)
-    {
-        Filter *f = itr->second;
+    const int num_filters = plan.number_of_filters();
+    const int num_travs   = (int)plan.m_traversals.size();
 
-        // check for snk
-        if( !f->output_port() || 
-             graph.edges_out(f->name()).number_of_children() == 0)
-        {
-            snks.append().set(f->name());
-        }
+    for(int t = 0; t < num_travs; t++)
+    {
+        int t_end = t + 1 < num_travs ? plan.m_traversals[t+1] : num_filters;
 
-        // check for src
-        if( f->output_port() && 
-            !graph.edges()["in"].has_child(f->name()) )
+        // conduit nodes keep insert order, so we can use
+        // obj instead of list
+        Node &trav = traversals.append();
+        for(int i = plan.m_traversals[t]; i < t_end; i++)
         {
-            srcs.append().set(f->name());
+            trav[plan.m_names[i]] = plan.m_urefs[i];
         }
-            
-        
     }
+}
 
-    // init tags
-    Node tags;
-    for(itr  = graph.m_filters.begin();
-        itr != graph.m_filters.end() ; 
-        itr++)
+//-----------------------------------------------------------------------------
+std::string
+Workspace::ExecutionPlan::action_name(int action)
+{
+    if(action == RUN)
     {
-        Filter *f = itr->second;
-        tags[f->name()].set_int32(0);
-
+        return "run";
     }
-
-    // execute bf traversal from each snk
-
-    NodeConstIterator snk_itr(&snks);
-    while(snk_itr.has_next())
+    else if(action == REUSE)
     {
-        std::string snk_name = snk_itr.next().as_string();
-
-        Node snk_trav;
-        bf_topo_sort_visit(graph, snk_name, tags, snk_trav);
-        if(snk_trav.number_of_children() > 0)
-        {
-            traversals.append().set(snk_trav);
-        }
+        return "reuse";
     }
-}
 
+    return "skip";
+}
 
 //-----------------------------------------------------------------------------
 void
-Workspace::ExecutionPlan::bf_topo_sort_visit(Graph &graph,
-                                             const std::string &f_name,
-                                             conduit::Node &tags,
-                                             conduit::Node &trav)
+Workspace::ExecutionPlan::order_by_plan()
 {
-    if( tags[f_name].as_int32() != 0 )
+    const int num_filters = number_of_filters();
+    m_order.resize(num_filters);
+    for(int i = 0; i < num_filters; i++)
     {
-        return;
+        m_order[i] = i;
     }
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::ExecutionPlan::order_by_memory()
+{
+    const int num_filters = number_of_filters();
 
-    int uref = 1;
-    tags[f_name].set_int32(1);
+    // inputs not yet produced, and refs left on each output
+    std::vector<int>  pending(num_filters,0);
+    std::vector<int>  refs(num_filters,0);
+    std::vector<bool> done(num_filters,false);
+    // non-concurrent filters, which must keep their plan order
+    std::vector<int>  serial;
 
-    Filter *f = graph.m_filters[f_name];
-    
-    if(f->output_port())
+    for(int i = 0; i < num_filters; i++)
     {
-        int num_refs = graph.edges_out(f_name).number_of_children();
-        uref = num_refs > 0 ? num_refs : 1;
+        pending[i] = (int)m_inputs[i].size();
+        refs[i]    = (int)m_consumers[i].size();
+        if(!m_concurrent[i])
+        {
+            serial.push_back(i);
+        }
     }
-    
-    if ( f->port_names().number_of_children() > 0 )
+
+    m_order.clear();
+    size_t serial_idx = 0;
+
+    // greedy: among the filters whose inputs are ready, pick the one with
+    // the smallest change in live bytes (ties go to the plan order).
+    // plan order is topological, so the next non-concurrent filter
+    // always becomes ready.
+    while((int)m_order.size() < num_filters)
     {
-        NodeConstIterator f_inputs(&graph.edges_in(f_name));
-        
-        while(f_inputs.has_next())
+        int     best_idx   = -1;
+        index_t best_delta = 0;
+
+        for(int i = 0; i < num_filters; i++)
         {
-            const Node &n_f_input = f_inputs.next();
-            
-            if(n_f_input.dtype().is_string())
+            if(done[i] || pending[i] > 0 ||
+               (!m_concurrent[i] && 
+                (serial_idx >= serial.size() || serial[serial_idx] != i)))
             {
-                std::string f_in_name = n_f_input.as_string();
-                bf_topo_sort_visit(graph, f_in_name, tags, trav);
+                continue;
             }
-            else //  missing input.
+
+            index_t delta = 0;
+            if(m_actions[i] == RUN && m_filters[i]->output_port())
             {
-                index_t port_idx = f_inputs.index();
-                CONDUIT_ERROR("Filter " << f->detailed_name()
-                              << " is missing connection to input port "
-                              << port_idx 
-                              << " ("
-                              << f->port_index_to_name(port_idx) 
-                              << ")");
-                uref = 0;
+                // unknown sizes count as one byte, which still favors 
+                // holding fewer outputs
+                delta += m_out_bytes[i] < 0 ? 1 : m_out_bytes[i];
             }
-        }
-    }
 
-    // conduit nodes keep insert order, so we can use
-    // obj instead of list
-    if(uref > 0)
-    {
-        trav[f_name] = uref;
-    }
+            const std::vector<int> &inputs = m_inputs[i];
+            for(size_t p = 0; p < inputs.size(); p++)
+            {
+                int src_idx = inputs[p];
+
+                // count each source once, even if it feeds several ports
+                if(std::find(inputs.begin(), inputs.begin() + p, src_idx)
+                   != inputs.begin() + p)
+                {
+                    continue;
+                }
+
+                int uses = (int)std::count(inputs.begin(), 
+                                           inputs.end(),
+                                           src_idx);
+
+                // last consumer releases uncached outputs
+                if(refs[src_idx] == uses && 
+                   m_actions[src_idx] == RUN &&
+                   !m_cacheable[src_idx])
+                {
+                    delta -= m_out_bytes[src_idx] < 0 ? 1 : 
+                                                        m_out_bytes[src_idx];
+                }
+            }
 
-}
+            if(best_idx == -1 || delta < best_delta)
+            {
+                best_idx   = i;
+                best_delta = delta;
+            }
+        }
 
-//-----------------------------------------------------------------------------
-//-----------------------------------------------------------------------------
+        done[best_idx] = true;
+        m_order.push_back(best_idx);
 
-//-----------------------------------------------------------------------------
-Workspace::Workspace()
-:m_graph(this)
-{
+        if(!m_concurrent[best_idx])
+        {
+            serial_idx++;
+        }
+
+        const std::vector<int> &inputs = m_inputs[best_idx];
+        for(size_t p = 0; p < inputs.size(); p++)
+        {
+            refs[inputs[p]]--;
+        }
 
+        const std::vector<int> &consumers = m_consumers[best_idx];
+        for(size_t c = 0; c < consumers.size(); c++)
+        {
+            pending[consumers[c]]--;
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
-Workspace::~Workspace()
+index_t
+Workspace::ExecutionPlan::peak_bytes(const std::vector<int> &order,
+                                     index_t unknown_bytes) const
 {
+    const int num_filters = number_of_filters();
+    std::vector<int> refs(num_filters,0);
+    for(int i = 0; i < num_filters; i++)
+    {
+        refs[i] = (int)m_consumers[i].size();
+    }
 
-}
+    index_t live = 0;
+    index_t peak = 0;
 
-//-----------------------------------------------------------------------------
-Graph &
-Workspace::graph()
-{
-    return m_graph;
+    for(size_t o = 0; o < order.size(); o++)
+    {
+        int idx = order[o];
+
+        if(m_actions[idx] == RUN && m_filters[idx]->output_port())
+        {
+            live += m_out_bytes[idx] < 0 ? unknown_bytes : m_out_bytes[idx];
+            peak  = std::max(peak,live);
+        }
+
+        const std::vector<int> &inputs = m_inputs[idx];
+        for(size_t p = 0; p < inputs.size(); p++)
+        {
+            int src_idx = inputs[p];
+            refs[src_idx]--;
+            if(refs[src_idx] == 0 && 
+               m_actions[src_idx] == RUN &&
+               !m_cacheable[src_idx])
+            {
+                live -= m_out_bytes[src_idx] < 0 ? unknown_bytes :
+                                                   m_out_bytes[src_idx];
+            }
+        }
+    }
+
+    return peak;
 }
 
 //-----------------------------------------------------------------------------
-const Graph &
-Workspace::graph() const
+int
+Workspace::ExecutionPlan::unknown_bytes_outputs() const
 {
-    return m_graph;
+    int res = 0;
+    for(int i = 0; i < number_of_filters(); i++)
+    {
+        if(m_actions[i] == RUN && 
+           m_filters[i]->output_port() &&
+           m_out_bytes[i] < 0)
+        {
+            res++;
+        }
+    }
+    return res;
 }
 
-
 //-----------------------------------------------------------------------------
-Registry &
-Workspace::registry()
+bool
+Workspace::ExecutionPlan::is_current(const Graph &graph) const
 {
-    return m_registry;
+    return m_compiled && m_version == graph.version();
 }
 
 //-----------------------------------------------------------------------------
-const Registry &
-Workspace::registry() const
+int
+Workspace::ExecutionPlan::number_of_filters() const
 {
-    return m_registry;
+    return (int)m_filters.size();
 }
 
 //-----------------------------------------------------------------------------
 void
-Workspace::traversals(Node &traversals) 
+Workspace::ExecutionPlan::compile(Graph &graph)
 {
-    traversals.reset();
-    ExecutionPlan::generate(graph(),traversals);
+    m_traversals.clear();
+    m_ids.clear();
+    m_filters.clear();
+    m_names.clear();
+    m_urefs.clear();
+    m_concurrent.clear();
+    m_cacheable.clear();
+    m_generations.clear();
+    m_port_names.clear();
+    m_inputs.clear();
+    m_consumers.clear();
+    m_has_cacheable = false;
+    m_actions.clear();
+    m_keys.clear();
+    m_gen_tables.clear();
+    m_gen_digests.clear();
+    m_order.clear();
+    m_out_bytes.clear();
+    m_compiled = false;
+
+    const int num_ids = graph.number_of_filter_ids();
+
+    // visited tags and plan index of each filter id
+    std::vector<int> tags(num_ids,0);
+    std::vector<int> plan_idxs(num_ids,-1);
+
+    // execute a traversal from each snk, in name order
+    std::map<std::string,int>::const_iterator itr;
+    for(itr  = graph.m_filter_ids.begin();
+        itr != graph.m_filter_ids.end();
+        itr++)
+    {
+        int     f_id = itr->second;
+        Filter *f    = graph.filter(f_id);
+
+        // check for snk
+        if( f->output_port() && !graph.outputs(f_id).empty() )
+        {
+            continue;
+        }
+
+        int trav_start = number_of_filters();
+        bf_topo_sort_visit(graph, f_id, tags, plan_idxs);
+        if(number_of_filters() > trav_start)
+        {
+            m_traversals.push_back(trav_start);
+        }
+    }
+
+    const int num_filters = number_of_filters();
+    m_port_names.resize(num_filters);
+    m_inputs.resize(num_filters);
+    m_consumers.resize(num_filters);
+    m_out_bytes.assign(num_filters,-1);
+
+    for(int i = 0; i < num_filters; i++)
+    {
+        Filter *f = m_filters[i];
+        const std::vector<int> &f_inputs = graph.inputs(m_ids[i]);
+
+        for(size_t port_idx = 0; port_idx < f_inputs.size(); port_idx++)
+        {
+            int src_idx = plan_idxs[f_inputs[port_idx]];
+
+            m_port_names[i].push_back(f->port_index_to_name((int)port_idx));
+            m_inputs[i].push_back(src_idx);
+            m_consumers[src_idx].push_back(i);
+        }
+    }
+
+    m_version  = graph.version();
+    m_compiled = true;
 }
 
+
 //-----------------------------------------------------------------------------
 void
-Workspace::execute()
+Workspace::ExecutionPlan::bf_topo_sort_visit(Graph &graph,
+                                             int f_id,
+                                             std::vector<int> &tags,
+                                             std::vector<int> &plan_idxs)
 {
-    Node traversals;
-    ExecutionPlan::generate(graph(),traversals);
+    if( tags[f_id] != 0 )
+    {
+        return;
+    }
 
-    
-    // execute traversals 
-    NodeIterator travs_itr = traversals.children();
-    
-    while(travs_itr.has_next())
+    // iterative post order traversal, so deep graphs don't 
+    // exhaust the stack. each entry holds a filter id and the
+    // next input port to visit.
+    std::vector<std::pair<int,int> > stack;
+
+    tags[f_id] = 1;
+    stack.push_back(std::make_pair(f_id,0));
+
+    while(!stack.empty())
     {
-        NodeIterator trav_itr(&travs_itr.next());
+        int  curr_id  = stack.back().first;
+        int &port_idx = stack.back().second;
 
-        while(trav_itr.has_next())
+        const std::vector<int> &f_inputs = graph.inputs(curr_id);
+
+        if(port_idx < (int)f_inputs.size())
         {
-            Node &t = trav_itr.next();
-            
-            std::string  f_name = trav_itr.name();
-            int          uref   = t.to_int32();
-            Filter      *f      = graph().filters()[f_name];
-        
-            f->reset_inputs_and_output();
+            int src_id = f_inputs[port_idx];
 
-            // fetch inputs from reg, attach to filter's ports
-            NodeConstIterator ports_itr = NodeConstIterator(&f->port_names());
-            registry().print();
-            std::vector<std::string> f_i_names;
-            while(ports_itr.has_next())
+            if(src_id == -1) //  missing input.
             {
-                std::string port_name = ports_itr.next().as_string();
-                std::string f_input_name = graph().edges_in(f_name)[port_name].as_string();
-                f->set_input(port_name,&registry().fetch(f_input_name));
+                Filter *f = graph.filter(curr_id);
+                CONDUIT_ERROR("Filter " << f->detailed_name()
+                              << " is missing connection to input port "
+                              << port_idx 
+                              << " ("
+                              << f->port_index_to_name(port_idx) 
+                              << ")");
             }
 
+            port_idx++;
+
+            if(tags[src_id] == 0)
+            {
+                tags[src_id] = 1;
+                stack.push_back(std::make_pair(src_id,0));
+            }
+        }
+        else
+        {
+            stack.pop_back();
 
-            // execute 
-            f->execute();
+            Filter *f = graph.filter(curr_id);
 
-            // if has output, set output
+            int uref = 1;
             if(f->output_port())
             {
-                
-                registry().add(f_name,
-                               f->output(),
-                               uref);
+                int num_refs = (int)graph.outputs(curr_id).size();
+                uref = num_refs > 0 ? num_refs : 1;
             }
+
+            plan_idxs[curr_id] = number_of_filters();
+            m_ids.push_back(curr_id);
+            m_filters.push_back(f);
+            m_names.push_back(f->name());
+            m_urefs.push_back(uref);
+            m_concurrent.push_back(f->concurrent());
+            m_cacheable.push_back(f->cacheable());
+            m_generations.push_back(f->generations());
             
-            f->reset_inputs_and_output();
-            
-            // consume inputs
-            ports_itr.to_front();
-            while(ports_itr.has_next())
+            if(f->cacheable())
             {
-                std::string port_name = ports_itr.next().as_string();
-                std::string f_input_name = graph().edges_in(f_name)[port_name].as_string();
-                registry().consume(f_input_name);
+                m_has_cacheable = true;
             }
         }
     }
-    
-    
 }
 
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+Workspace::Profile::Profile()
+: m_live_entries(0),
+  m_live_bytes(0),
+  m_max_entries(0),
+  m_max_bytes(0)
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+Workspace::Profile::~Profile()
+{
+    // empty
+}
 
 //-----------------------------------------------------------------------------
 void
-Workspace::reset()
+Workspace::Profile::begin(const ExecutionPlan &plan)
 {
-    graph().reset();
-    registry().reset();
+    const int num_filters = plan.number_of_filters();
+    m_fetch_times.assign(num_filters, 0.0);
+    m_exec_times.assign(num_filters, 0.0);
+    m_out_types.assign(num_filters, "");
+    m_out_bytes.assign(num_filters, 0);
+    m_live.assign(num_filters, false);
+
+    m_live_entries = 0;
+    m_live_bytes   = 0;
+    m_max_entries  = 0;
+    m_max_bytes    = 0;
+
+    m_start = Clock::now();
 }
 
+//-----------------------------------------------------------------------------
+void
+Workspace::Profile::set_times(int idx,
+                              const Clock::time_point &t_start,
+                              const Clock::time_point &t_fetched,
+                              const Clock::time_point &t_executed)
+{
+    // each filter only sets its own slot, no need to lock
+    m_fetch_times[idx] = std::chrono::duration<double>(t_fetched - 
+                                                       t_start).count();
+    m_exec_times[idx]  = std::chrono::duration<double>(t_executed - 
+                                                       t_fetched).count();
+}
 
 //-----------------------------------------------------------------------------
 void
-Workspace::info(Node &out) const
+Workspace::Profile::set_output(int idx, Data &out, index_t num_bytes)
+{
+    m_out_types[idx] = data_type_name(out);
+    m_out_bytes[idx] = num_bytes;
+    output_added(idx, num_bytes);
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::Profile::output_added(int idx, index_t num_bytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_live[idx] = true;
+    m_live_entries++;
+    m_live_bytes += num_bytes;
+
+    m_max_entries = std::max(m_max_entries, m_live_entries);
+    m_max_bytes   = std::max(m_max_bytes, m_live_bytes);
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::Profile::output_released(int idx)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(!m_live[idx])
+    {
+        return;
+    }
+
+    m_live[idx] = false;
+    m_live_entries--;
+    m_live_bytes -= m_out_bytes[idx];
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::Profile::end(const ExecutionPlan &plan, Node &out)
+{
+    out.reset();
+    out["time"] = std::chrono::duration<double>(Clock::now() - 
+                                                m_start).count();
+
+    Node &filters = out["filters"];
+    filters.set(DataType::object());
+
+    // filters in plan order
+    for(int i = 0; i < plan.number_of_filters(); i++)
+    {
+        Node &f_info = filters[plan.m_names[i]];
+        f_info["type_name"]    = plan.m_filters[i]->type_name();
+        f_info["action"]       = ExecutionPlan::action_name(plan.m_actions[i]);
+        f_info["fetch_time"]   = m_fetch_times[i];
+        f_info["execute_time"] = m_exec_times[i];
+
+        if(!m_out_types[i].empty())
+        {
+            f_info["output_type"]  = m_out_types[i];
+            f_info["output_bytes"] = m_out_bytes[i];
+        }
+    }
+
+    out["registry/high_water/entries"] = m_max_entries;
+    out["registry/high_water/bytes"]   = m_max_bytes;
+}
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+Workspace::Scheduler::Scheduler(Workspace &w,
+                                ExecutionPlan &plan)
+: m_workspace(w),
+  m_plan(plan),
+  m_num_done(0),
+  m_stop(false)
+{
+    const int num_filters = plan.number_of_filters();
+    m_pending.resize(num_filters,0);
+    m_position.resize(num_filters,0);
+
+    for(int pos = 0; pos < num_filters; pos++)
+    {
+        int i = plan.m_order[pos];
+        m_position[i] = pos;
+        m_pending[i]  = (int)plan.m_inputs[i].size();
+
+        if(!plan.m_concurrent[i])
+        {
+            m_serial.push_back(i);
+        }
+        else if(m_pending[i] == 0)
+        {
+            m_ready.insert(pos);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+Workspace::Scheduler::~Scheduler()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::Scheduler::execute(int num_threads)
+{
+    std::vector<std::thread> workers;
+    for(int i = 1; i < num_threads; i++)
+    {
+        workers.push_back(std::thread(&Scheduler::worker,this));
+    }
+
+    const int num_filters = m_plan.number_of_filters();
+    size_t    serial_idx  = 0;
+
+    // the calling thread executes the non-concurrent filters in plan 
+    // order, and helps out with ready concurrent filters in between.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while(!m_stop && m_num_done < num_filters)
+    {
+        int idx = -1;
+
+        if(serial_idx < m_serial.size() && 
+           m_pending[m_serial[serial_idx]] == 0)
+        {
+            idx = m_serial[serial_idx];
+            serial_idx++;
+        }
+        else if(!m_ready.empty())
+        {
+            idx = m_plan.m_order[*m_ready.begin()];
+            m_ready.erase(m_ready.begin());
+        }
+
+        if(idx == -1)
+        {
+            m_cond.wait(lock);
+        }
+        else
+        {
+            lock.unlock();
+            run(idx);
+            lock.lock();
+        }
+    }
+
+    m_stop = true;
+    lock.unlock();
+    m_cond.notify_all();
+
+    for(size_t i = 0; i < workers.size(); i++)
+    {
+        workers[i].join();
+    }
+
+    // forward the first error raised by any filter
+    if(m_error)
+    {
+        std::rethrow_exception(m_error);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::Scheduler::worker()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while(!m_stop)
+    {
+        if(m_ready.empty())
+        {
+            m_cond.wait(lock);
+        }
+        else
+        {
+            int idx = m_plan.m_order[*m_ready.begin()];
+            m_ready.erase(m_ready.begin());
+            lock.unlock();
+            run(idx);
+            lock.lock();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::Scheduler::run(int idx)
+{
+    try
+    {
+        m_workspace.execute_filter(m_plan,idx);
+    }
+    catch(...)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(!m_error)
+        {
+            m_error = std::current_exception();
+        }
+        m_stop = true;
+        m_cond.notify_all();
+        return;
+    }
+
+    complete(idx);
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::Scheduler::complete(int idx)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_num_done++;
+
+        const std::vector<int> &consumers = m_plan.m_consumers[idx];
+        for(size_t i = 0; i < consumers.size(); i++)
+        {
+            int c_idx = consumers[i];
+            m_pending[c_idx]--;
+            if(m_pending[c_idx] == 0 && m_plan.m_concurrent[c_idx])
+            {
+                m_ready.insert(m_position[c_idx]);
+            }
+        }
+    }
+    m_cond.notify_all();
+}
+
+//-----------------------------------------------------------------------------
+Workspace::Workspace()
+:m_graph(this),
+ m_num_threads(1),
+ m_plan(new ExecutionPlan()),
+ m_has_generations(false),
+ m_execute_count(0),
+ m_profiling(false),
+ m_profile(new Profile()),
+ m_ordering("plan"),
+ m_merge_filters(false),
+ m_high_water_bytes(-1),
+ m_plan_high_water_bytes(-1),
+ m_unknown_bytes_outputs(0)
+{
+
+}
+
+//-----------------------------------------------------------------------------
+Workspace::~Workspace()
+{
+    // release our registry refs before cached outputs
+    m_registry.reset();
+    delete m_profile;
+    delete m_plan;
+}
+
+//-----------------------------------------------------------------------------
+Graph &
+Workspace::graph()
+{
+    return m_graph;
+}
+
+//-----------------------------------------------------------------------------
+const Graph &
+Workspace::graph() const
+{
+    return m_graph;
+}
+
+
+//-----------------------------------------------------------------------------
+Registry &
+Workspace::registry()
+{
+    return m_registry;
+}
+
+//-----------------------------------------------------------------------------
+const Registry &
+Workspace::registry() const
+{
+    return m_registry;
+}
+
+//-----------------------------------------------------------------------------
+Cache &
+Workspace::cache()
+{
+    return m_cache;
+}
+
+//-----------------------------------------------------------------------------
+const Cache &
+Workspace::cache() const
+{
+    return m_cache;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::traversals(Node &traversals) 
+{
+    traversals.reset();
+    ExecutionPlan::generate(graph(),traversals);
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::set_number_of_threads(int num_threads)
+{
+    if(num_threads < 1)
+    {
+        CONDUIT_ERROR("flow::Workspace number of threads must be >= 1"
+                      " (passed " << num_threads << ")");
+    }
+
+    m_num_threads = num_threads;
+}
+
+//-----------------------------------------------------------------------------
+int
+Workspace::number_of_threads() const
+{
+    return m_num_threads;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::set_profiling(bool enabled)
+{
+    m_profiling = enabled;
+    m_last_profile.reset();
+}
+
+//-----------------------------------------------------------------------------
+bool
+Workspace::profiling() const
+{
+    return m_profiling;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::profile(Node &out) const
+{
+    out.set(m_last_profile);
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::set_ordering(const std::string &ordering)
+{
+    if(ordering != "plan" && ordering != "memory")
+    {
+        CONDUIT_ERROR("flow::Workspace unknown ordering: \"" << ordering 
+                      << "\" (expected \"plan\" or \"memory\")");
+    }
+
+    m_ordering = ordering;
+    m_high_water_bytes      = -1;
+    m_plan_high_water_bytes = -1;
+    m_unknown_bytes_outputs = 0;
+}
+
+//-----------------------------------------------------------------------------
+const std::string &
+Workspace::ordering() const
+{
+    return m_ordering;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::memory_info(Node &out) const
+{
+    out.reset();
+    out["ordering"] = m_ordering;
+
+    if(m_high_water_bytes >= 0)
+    {
+        out["high_water_bytes"]      = m_high_water_bytes;
+        out["plan_high_water_bytes"] = m_plan_high_water_bytes;
+        // outputs of unknown size are not counted in the high-water marks
+        out["unknown_bytes_outputs"] = m_unknown_bytes_outputs;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::set_merge_filters(bool enabled)
+{
+    m_merge_filters = enabled;
+}
+
+//-----------------------------------------------------------------------------
+bool
+Workspace::merge_filters() const
+{
+    return m_merge_filters;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::merged_filters(Node &out) const
+{
+    out.set(m_merged_filters);
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::set_generations(const Node &gens)
+{
+    m_generations.set(gens);
+    m_has_generations = true;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::execute()
+{
+    // only walk the graph when it changed since the last execute
+    if(!m_plan->is_current(graph()))
+    {
+        if(m_merge_filters)
+        {
+            graph().merge_common_filters(m_merged_filters);
+        }
+
+        m_plan->compile(graph());
+    }
+
+    m_execute_count++;
+
+    // outputs used by the last execute can now be evicted
+    m_cache.unpin_all();
+    trim_cache();
+
+    prepare_execute();
+
+    bool memory_ordering = m_ordering == "memory";
+
+    if(memory_ordering)
+    {
+        m_plan->order_by_memory();
+    }
+    else
+    {
+        m_plan->order_by_plan();
+    }
+
+    if(m_profiling)
+    {
+        m_profile->begin(*m_plan);
+    }
+
+    if(m_num_threads > 1)
+    {
+        Scheduler scheduler(*this,*m_plan);
+        scheduler.execute(m_num_threads);
+    }
+    else
+    {
+        // execute filters in order
+        const int num_filters = m_plan->number_of_filters();
+        for(int i = 0; i < num_filters; i++)
+        {
+            execute_filter(*m_plan,m_plan->m_order[i]);
+        }
+    }
+
+    // output sizes are measured when ordering by memory or profiling
+    if(memory_ordering || m_profiling)
+    {
+        std::vector<int> plan_order(m_plan->number_of_filters());
+        for(size_t i = 0; i < plan_order.size(); i++)
+        {
+            plan_order[i] = (int)i;
+        }
+
+        m_high_water_bytes      = m_plan->peak_bytes(m_plan->m_order,0);
+        m_plan_high_water_bytes = m_plan->peak_bytes(plan_order,0);
+        m_unknown_bytes_outputs = m_plan->unknown_bytes_outputs();
+    }
+    else
+    {
+        m_high_water_bytes      = -1;
+        m_plan_high_water_bytes = -1;
+        m_unknown_bytes_outputs = 0;
+    }
+
+    // drop cached outputs of filters that are no longer in the graph
+    std::set<std::string> cached_names;
+    for(int i = 0; i < m_plan->number_of_filters(); i++)
+    {
+        if(m_plan->m_cacheable[i])
+        {
+            cached_names.insert(m_plan->m_names[i]);
+        }
+    }
+    m_cache.retain_only(cached_names);
+
+    if(m_profiling)
+    {
+        m_profile->end(*m_plan, m_last_profile);
+        m_last_profile["execute_count"] = m_execute_count;
+    }
+
+    // published generations are only valid for one execute
+    m_has_generations = false;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::trim_cache()
+{
+    // drop registry entries left from previous executes that refer
+    // to evicted outputs
+    Registry &reg = registry();
+    m_cache.trim([&reg](const std::string &name, Data &data)
+                 {
+                     if(reg.has_entry(name) &&
+                        reg.fetch(name).data_ptr() == data.data_ptr())
+                     {
+                         reg.forget(name);
+                     }
+                 });
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::prepare_execute()
+{
+    ExecutionPlan &plan = *m_plan;
+    const int num_filters = plan.number_of_filters();
+
+    plan.m_actions.assign(num_filters, ExecutionPlan::RUN);
+
+    // w/o cacheable filters everything runs, no need for keys
+    if(!plan.m_has_cacheable)
+    {
+        return;
+    }
+
+    plan.m_keys.assign(num_filters, 0);
+    plan.m_gen_tables.resize(num_filters);
+    plan.m_gen_digests.assign(num_filters, 0);
+
+    std::vector<bool> hit(num_filters, false);
+
+    // forward pass: derive the key and output generations of each filter
+    for(int i = 0; i < num_filters; i++)
+    {
+        Filter *f = plan.m_filters[i];
+        const std::vector<int> &inputs = plan.m_inputs[i];
+
+        uint64 key = hash_combine(hash_string(f->type_name()),
+                                  hash_string(f->params().to_json()));
+
+        Node deps;
+        if(plan.m_cacheable[i])
+        {
+            f->declare_dependencies(deps);
+        }
+
+        for(size_t p = 0; p < inputs.size(); p++)
+        {
+            int src_idx = inputs[p];
+            const Node &src_gens = plan.m_gen_tables[src_idx];
+
+            // a declared dependency missing from the input's table
+            // falls back to depending on all of the input
+            bool use_deps = deps.number_of_children() > 0;
+            NodeConstIterator itr = deps.children();
+            while(use_deps && itr.has_next())
+            {
+                use_deps = src_gens.has_path(itr.next().as_string());
+            }
+
+            if(use_deps)
+            {
+                itr = deps.children();
+                while(itr.has_next())
+                {
+                    std::string path = itr.next().as_string();
+                    key = hash_combine(key, hash_string(path));
+                    key = hash_combine(key, 
+                                       hash_generations(src_gens[path]));
+                }
+
+                // params of forwarding filters apply to all of the input
+                if(src_gens.has_child("params"))
+                {
+                    key = hash_combine(key,
+                                       hash_generations(src_gens["params"]));
+                }
+            }
+            else
+            {
+                key = hash_combine(key, plan.m_gen_digests[src_idx]);
+            }
+        }
+
+        const std::string &gen_mode = plan.m_generations[i];
+        Node &gens = plan.m_gen_tables[i];
+        gens.reset();
+
+        // sources that create new data must be considered changed 
+        // every execute, unless they are cacheable
+        if(inputs.empty() && gen_mode == "new" && !plan.m_cacheable[i])
+        {
+            key = hash_combine(key, m_execute_count);
+        }
+
+        if(gen_mode == "published")
+        {
+            if(m_has_generations)
+            {
+                gens.set(m_generations);
+            }
+            else
+            {
+                gens["unpublished"] = m_execute_count;
+            }
+        }
+        else if(gen_mode == "forward" && !inputs.empty())
+        {
+            gens.set(plan.m_gen_tables[inputs[0]]);
+            // params can select what is forwarded (e.g. a subset of
+            // fields), so they are part of the forwarded table
+            if(f->params().number_of_children() > 0)
+            {
+                gens["params"] = hash_string(f->params().to_json());
+            }
+        }
+        else
+        {
+            gens["output"] = key;
+        }
+
+        plan.m_keys[i]        = key;
+        plan.m_gen_digests[i] = hash_generations(gens);
+
+        // pin hits, so they stay around until we use them
+        hit[i] = plan.m_cacheable[i] && 
+                 m_cache.pin(plan.m_names[i],key);
+    }
+
+    // backward pass: a filter is needed if it is a sink, or if 
+    // any of its consumers run
+    for(int i = num_filters - 1; i >= 0; i--)
+    {
+        const std::vector<int> &consumers = plan.m_consumers[i];
+
+        bool needed = !plan.m_filters[i]->output_port() || consumers.empty();
+
+        for(size_t c = 0; c < consumers.size() && !needed; c++)
+        {
+            needed = plan.m_actions[consumers[c]] == ExecutionPlan::RUN;
+        }
+
+        if(!needed)
+        {
+            plan.m_actions[i] = ExecutionPlan::SKIP;
+        }
+        else if(hit[i])
+        {
+            plan.m_actions[i] = ExecutionPlan::REUSE;
+        }
+        else
+        {
+            plan.m_actions[i] = ExecutionPlan::RUN;
+        }
+    }
+
+    if(logging::enabled(logging::LEVEL_DEBUG))
+    {
+        Node actions;
+        for(int i = 0; i < num_filters; i++)
+        {
+            actions[plan.m_names[i]] = ExecutionPlan::action_name(plan.m_actions[i]);
+        }
+        FLOW_DEBUG("Workspace execute actions: " << actions.to_json());
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::execute_filter(ExecutionPlan &plan, int idx)
+{
+    Filter *f = plan.m_filters[idx];
+    const std::string              &name       = plan.m_names[idx];
+    const std::vector<std::string> &port_names = plan.m_port_names[idx];
+    const std::vector<int>         &inputs     = plan.m_inputs[idx];
+
+    int action = plan.m_actions[idx];
+
+    if(action == ExecutionPlan::REUSE)
+    {
+        // entries left from a previous execute refer to the
+        // cached output, drop them w/o releasing
+        registry().forget(name);
+        registry().add(name, *m_cache.fetch(name), -1);
+
+        if(m_profiling)
+        {
+            m_profile->output_added(idx, 0);
+        }
+    }
+    else if(action == ExecutionPlan::RUN)
+    {
+        Profile::Clock::time_point t_start = Profile::Clock::now();
+
+        f->reset_inputs_and_output();
+
+        // fetch inputs from reg, attach to filter's ports
+        FLOW_DEBUG(registry().to_json());
+        for(size_t i = 0; i < inputs.size(); i++)
+        {
+            f->set_input(port_names[i],
+                         &registry().fetch(plan.m_names[inputs[i]]));
+        }
+
+        Profile::Clock::time_point t_fetched = Profile::Clock::now();
+
+        // execute 
+        f->execute();
+
+        Profile::Clock::time_point t_executed = Profile::Clock::now();
+
+        // if has output, set output
+        if(f->output_port())
+        {
+            Data &out = f->output();
+
+            bool measure = m_profiling || m_ordering == "memory";
+
+            // -1 if unknown
+            index_t out_bytes = 0;
+            if(measure || plan.m_cacheable[idx])
+            {
+                out_bytes = f->output_bytes();
+            }
+            // outputs of unknown size count as 0 against the cache
+            // budget and in the profile
+            index_t known_bytes = out_bytes < 0 ? 0 : out_bytes;
+
+            // outputs that alias an input can't outlive this execute
+            bool aliased = false;
+            for(size_t i = 0; i < inputs.size() && !aliased; i++)
+            {
+                aliased = f->input(port_names[i]).data_ptr() == out.data_ptr();
+            }
+
+            if(measure)
+            {
+                // each filter is executed by one thread, no need to lock
+                plan.m_out_bytes[idx] = aliased ? 0 : out_bytes;
+            }
+
+            if(plan.m_cacheable[idx] && !aliased)
+            {
+                // entries left from a previous execute refer to the
+                // previously cached output
+                registry().forget(name);
+            }
+
+            if(plan.m_cacheable[idx] && !aliased &&
+               m_cache.store(name, plan.m_keys[idx], out, known_bytes))
+            {
+                // the cache owns the output, the registry does not track it
+                registry().add(name, out, -1);
+                trim_cache();
+            }
+            else
+            {
+                if(plan.m_cacheable[idx])
+                {
+                    m_cache.remove(name);
+                }
+
+                registry().add(name,
+                               out,
+                               plan.m_urefs[idx]);
+            }
+
+            if(m_profiling)
+            {
+                m_profile->set_output(idx, out, aliased ? 0 : known_bytes);
+            }
+        }
+
+        f->reset_inputs_and_output();
+
+        if(m_profiling)
+        {
+            m_profile->set_times(idx,
+                                 t_start,
+                                 t_fetched,
+                                 t_executed);
+        }
+    }
+
+    // consume inputs
+    for(size_t i = 0; i < inputs.size(); i++)
+    {
+        const std::string &src_name = plan.m_names[inputs[i]];
+        registry().consume(src_name);
+
+        if(m_profiling && !registry().has_entry(src_name))
+        {
+            m_profile->output_released(inputs[i]);
+        }
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+void
+Workspace::reset()
+{
+    graph().reset();
+    registry().reset();
+    m_merged_filters.reset();
+}
+
+
+//-----------------------------------------------------------------------------
+void
+Workspace::info(Node &out) const
 {
     out.reset();
     
     graph().info(out["graph"]);
     registry().info(out["registry"]);
+    cache().info(out["cache"]);
+    memory_info(out["memory"]);
+
+    if(m_merge_filters)
+    {
+        merged_filters(out["merged_filters"]);
+    }
+
+    if(m_profiling)
+    {
+        profile(out["profile"]);
+    }
 }
 
 
@@ -485,7 +1796,7 @@ Workspace::register_filter_type(FilterFactoryMethod fr)
 {
     if(supports_filter_type(fr))
     {
-        CONDUIT_INFO("TODO: Filter Already Registered");
+        FLOW_INFO("TODO: Filter Already Registered");
         return;
     }
         
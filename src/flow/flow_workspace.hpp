@@ -56,6 +56,7 @@
 
 #include <flow_data.hpp>
 #include <flow_registry.hpp>
+#include <flow_cache.hpp>
 #include <flow_graph.hpp>
 
 
@@ -94,14 +95,91 @@ public:
     Registry        &registry();
     /// const access to the registry
     const Registry  &registry() const;
+
+    /// access to the cache that retains outputs of cacheable filters
+    /// across executes
+    Cache           &cache();
+    /// const access to the cache
+    const Cache     &cache() const;
    
     /// compute and return the graph traverals 
     void             traversals(conduit::Node &out);
    
     /// execute the filter graph.
+    /// The execution plan is cached and only recompiled when
+    /// the graph changes (see Graph::version()).
+    /// Cacheable filters whose params and inputs are unchanged since
+    /// their last execute reuse their previous output, and filters
+    /// whose outputs are not needed by any running filter are skipped.
     void             execute();
+
+    /// set the generation table of the data published to the workspace
+    /// (e.g. by a runtime) for the next execute. The table maps paths 
+    /// (e.g. "fields/braid") to counters that change whenever that part
+    /// of the published data changes. Filters that declare 
+    /// "generations" = "published" use this table, cacheable filters
+    /// downstream are skipped when the parts they read are unchanged.
+    /// If no table is set before an execute, all published data is 
+    /// considered changed.
+    void             set_generations(const conduit::Node &gens);
+
+    /// set the number of threads used to execute the filter graph.
+    /// 1 (the default) executes filters one at a time on the calling 
+    /// thread. When > 1, filters whose inputs are ready are executed 
+    /// concurrently on a pool of worker threads. Filters that declare 
+    /// "concurrent" = "false" in their interface are always executed
+    /// on the calling thread, in plan order.
+    void             set_number_of_threads(int num_threads);
+    /// returns the number of threads used to execute the filter graph.
+    int              number_of_threads() const;
+
+    /// set the order used to execute filters:
+    ///  "plan" (the default) executes the traversal from each sink,
+    ///   in sink name order.
+    ///  "memory" greedily picks the next filter that least increases 
+    ///   the bytes of outputs held in the registry, using the refs left 
+    ///   on each output and output sizes measured during the previous
+    ///   execute (see Filter::output_bytes()). 
+    /// In both modes, filters that declare "concurrent" = "false" keep
+    /// their plan order, so MPI collectives happen in the same order 
+    /// on every rank.
+    void                set_ordering(const std::string &ordering);
+    const std::string  &ordering() const;
+
+    /// returns the ordering, and when output sizes were measured during 
+    /// the last execute (with "memory" ordering or profiling), the 
+    /// high-water mark of output bytes held at once for the order used 
+    /// and for the default plan order. (also included in info())
+    /// Outputs of unknown size (see Filter::output_bytes()) are not 
+    /// counted in the high-water marks, "unknown_bytes_outputs" reports
+    /// how many were created. When it is non zero, the marks are lower
+    /// bounds.
+    void                memory_info(conduit::Node &out) const;
+
+    /// enable or disable merging of common filters (disabled by default).
+    /// When enabled, each time the graph changes execute first merges
+    /// "mergeable" filters that have the same type, params and inputs 
+    /// (see Graph::merge_common_filters). Graphs built identically on 
+    /// every rank are merged identically.
+    void             set_merge_filters(bool enabled);
+    bool             merge_filters() const;
+    /// returns the filters removed by merging since the last reset, 
+    /// mapping each removed filter name to the name of the filter
+    /// that replaced it (also included in info())
+    void             merged_filters(conduit::Node &out) const;
+
+    /// enable or disable profiling of executes (disabled by default).
+    /// When enabled, each execute records the time spent fetching inputs
+    /// and executing each filter, output types and approximate sizes 
+    /// (see Filter::output_bytes()), and the high-water mark of filter
+    /// outputs held in the registry.
+    void             set_profiling(bool enabled);
+    bool             profiling() const;
+    /// returns the profile of the last execute (also included in info())
+    void             profile(conduit::Node &out) const;
     
     /// reset the registry and graph
+    /// (retained outputs stay in the cache, use cache().clear())
     void             reset();
    
     /// create human understandable tree that describes the state
@@ -162,9 +240,43 @@ private:
 
     class ExecutionPlan;
     class FilterFactory;
+    class Scheduler;
+    class Profile;
+
+    // decides which filters of the current plan run, reuse their
+    // cached output, or can be skipped during this execute
+    void        prepare_execute();
+    // evicts cached outputs to meet the cache budget
+    void        trim_cache();
+
+    // executes the filter at the given index of an execution plan: 
+    // binds its inputs from the registry, runs it, adds its output 
+    // and consumes its inputs.
+    void        execute_filter(ExecutionPlan &plan, int idx);
+
+    Graph            m_graph;
+    Registry         m_registry;
+    int              m_num_threads;
+    // last compiled plan, reused while the graph is unchanged
+    ExecutionPlan   *m_plan;
+
+    // incremental execution state
+    conduit::Node    m_generations;
+    bool             m_has_generations;
+    conduit::uint64  m_execute_count;
+    // retained outputs of cacheable filters
+    Cache            m_cache;
+
+    bool             m_profiling;
+    Profile         *m_profile;
+    conduit::Node    m_last_profile;
 
-    Graph       m_graph;
-    Registry    m_registry;
+    std::string      m_ordering;
+    bool             m_merge_filters;
+    conduit::Node    m_merged_filters;
+    conduit::index_t m_high_water_bytes;
+    conduit::index_t m_plan_high_water_bytes;
+    int              m_unknown_bytes_outputs;
    
 
    
@@ -121,3 +121,285 @@ TEST(ascent_pipeline, test_render_2d_main_pipeline)
     // // check that we created an image
     EXPECT_TRUE(check_test_image(output_file));
 }
+
+//-----------------------------------------------------------------------------
+TEST(ascent_pipeline, test_render_persistent_graph)
+{
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               data);
+    
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path, 
+                                                        "tout_render_3d_persistent");
+
+    //
+    // Create the actions, which are the same each cycle.
+    //
+    conduit::Node pipelines;
+    pipelines["pl1/f1/type"] = "contour";
+    pipelines["pl1/f1/params/field"] = "braid";
+    pipelines["pl1/f1/params/iso_values"] = 0.;
+
+    conduit::Node scenes;
+    scenes["s1/plots/p1/type"]         = "pseudocolor";
+    scenes["s1/plots/p1/pipeline"]     = "pl1";
+    scenes["s1/plots/p1/params/field"] = "braid";
+    scenes["s1/image_prefix"] = output_file;
+ 
+    conduit::Node actions;
+    conduit::Node &add_pipelines = actions.append();
+    add_pipelines["action"] = "add_pipelines";
+    add_pipelines["pipelines"] = pipelines;
+    conduit::Node &add_scenes = actions.append();
+    add_scenes["action"] = "add_scenes";
+    add_scenes["scenes"] = scenes;
+    conduit::Node &execute  = actions.append();
+    execute["action"] = "execute";
+    conduit::Node &reset  = actions.append();
+    reset["action"] = "reset";
+    
+    //
+    // Run Ascent
+    //
+    
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent_opts["runtime/persistent"] = "true";
+    ascent.open(ascent_opts);
+
+    // the first cycle builds the graph, the others reuse it
+    for(int cycle = 0; cycle < 3; cycle++)
+    {
+        remove_test_image(output_file);
+        data["state/cycle"] = cycle;
+        ascent.publish(data);
+        ascent.execute(actions);
+        EXPECT_TRUE(check_test_image(output_file));
+    }
+
+    // changing the actions rebuilds the graph
+    string output_file_changed = conduit::utils::join_file_path(output_path, 
+                                                        "tout_render_3d_persistent_changed");
+    remove_test_image(output_file_changed);
+    actions[1]["scenes/s1/image_prefix"] = output_file_changed;
+    ascent.publish(data);
+    ascent.execute(actions);
+    EXPECT_TRUE(check_test_image(output_file_changed));
+
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_pipeline, test_render_cached_contour)
+{
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               data);
+    
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path, 
+                                                        "tout_render_3d_cached_contour");
+
+    // tell ascent nothing changed between cycles
+    data["state/changed/fields"].set(DataType::list());
+
+    conduit::Node pipelines;
+    pipelines["pl1/f1/type"] = "contour";
+    pipelines["pl1/f1/params/field"] = "braid";
+    pipelines["pl1/f1/params/iso_values"] = 0.;
+
+    conduit::Node scenes;
+    scenes["s1/plots/p1/type"]         = "pseudocolor";
+    scenes["s1/plots/p1/pipeline"]     = "pl1";
+    scenes["s1/plots/p1/params/field"] = "braid";
+    scenes["s1/image_prefix"] = output_file;
+ 
+    conduit::Node actions;
+    conduit::Node &add_pipelines = actions.append();
+    add_pipelines["action"] = "add_pipelines";
+    add_pipelines["pipelines"] = pipelines;
+    conduit::Node &add_scenes = actions.append();
+    add_scenes["action"] = "add_scenes";
+    add_scenes["scenes"] = scenes;
+    conduit::Node &execute  = actions.append();
+    execute["action"] = "execute";
+    conduit::Node &reset  = actions.append();
+    reset["action"] = "reset";
+    
+    //
+    // Run Ascent
+    //
+    
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent_opts["runtime/cache/max_bytes"] = 1 << 30;
+    ascent.open(ascent_opts);
+
+    for(int cycle = 0; cycle < 3; cycle++)
+    {
+        remove_test_image(output_file);
+        ascent.publish(data);
+        ascent.execute(actions);
+        EXPECT_TRUE(check_test_image(output_file));
+    }
+
+    // the contour is only computed in the first cycle
+    Node info;
+    ascent.info(info);
+    info.print();
+    EXPECT_EQ(info["runtime/cache/max_bytes"].to_int64(),1 << 30);
+    EXPECT_TRUE(info["runtime/cache/hits"].to_int64() >= 2);
+
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_pipeline, test_render_cached_contour_new_plot_field)
+{
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               data);
+    
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+    string output_path = prepare_output_dir();
+
+    // tell ascent nothing changed between cycles
+    data["state/changed/fields"].set(DataType::list());
+
+    conduit::Node pipelines;
+    pipelines["pl1/f1/type"] = "contour";
+    pipelines["pl1/f1/params/field"] = "braid";
+    pipelines["pl1/f1/params/iso_values"] = 0.;
+
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent_opts["runtime/cache/max_bytes"] = 1 << 30;
+    ascent.open(ascent_opts);
+
+    // the plot colors the contour by a different field each cycle,
+    // so the contour must be recomputed with that field
+    const char *plot_fields[] = {"braid", "radial"};
+    for(int cycle = 0; cycle < 2; cycle++)
+    {
+        string output_file = conduit::utils::join_file_path(output_path, 
+                               std::string("tout_render_3d_cached_contour_") + 
+                               plot_fields[cycle]);
+        remove_test_image(output_file);
+
+        conduit::Node scenes;
+        scenes["s1/plots/p1/type"]         = "pseudocolor";
+        scenes["s1/plots/p1/pipeline"]     = "pl1";
+        scenes["s1/plots/p1/params/field"] = plot_fields[cycle];
+        scenes["s1/image_prefix"] = output_file;
+     
+        conduit::Node actions;
+        conduit::Node &add_pipelines = actions.append();
+        add_pipelines["action"] = "add_pipelines";
+        add_pipelines["pipelines"] = pipelines;
+        conduit::Node &add_scenes = actions.append();
+        add_scenes["action"] = "add_scenes";
+        add_scenes["scenes"] = scenes;
+        conduit::Node &execute  = actions.append();
+        execute["action"] = "execute";
+        conduit::Node &reset  = actions.append();
+        reset["action"] = "reset";
+
+        ascent.publish(data);
+        ascent.execute(actions);
+        EXPECT_TRUE(check_test_image(output_file));
+    }
+
+    ascent.close();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_pipeline, test_render_profiled)
+{
+    //
+    // Create example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               EXAMPLE_MESH_SIDE_DIM,
+                                               data);
+    
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path, 
+                                                        "tout_render_3d_profiled");
+    string profile_file = conduit::utils::join_file_path(output_path, 
+                                                         "ascent_profile_cycle_000042.json");
+    remove_test_image(output_file);
+    if(conduit::utils::is_file(profile_file))
+    {
+        conduit::utils::remove_file(profile_file);
+    }
+
+    data["state/cycle"] = 42;
+
+    conduit::Node scenes;
+    scenes["s1/plots/p1/type"]         = "pseudocolor";
+    scenes["s1/plots/p1/params/field"] = "braid";
+    scenes["s1/image_prefix"] = output_file;
+ 
+    conduit::Node actions;
+    conduit::Node &add_scenes = actions.append();
+    add_scenes["action"] = "add_scenes";
+    add_scenes["scenes"] = scenes;
+    conduit::Node &execute  = actions.append();
+    execute["action"] = "execute";
+    
+    //
+    // Run Ascent
+    //
+    
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent_opts["runtime/profiling/enabled"] = "true";
+    ascent_opts["runtime/profiling/output_dir"] = output_path;
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    Node info;
+    ascent.info(info);
+    ascent.close();
+
+    EXPECT_TRUE(check_test_image(output_file));
+
+    // the profile is in the info and saved for the cycle
+    EXPECT_EQ(info["runtime/profile/filters/vtkh_data/type_name"].as_string(),
+              "ensure_vtkh");
+    EXPECT_TRUE(conduit::utils::is_file(profile_file));
+}
@@ -0,0 +1,288 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-716457
+// 
+// All rights reserved.
+// 
+// This file is part of Ascent. 
+// 
+// For details, see: http://software.llnl.gov/ascent/.
+// 
+// Please also read ascent/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_ascent_block_timer.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <ascent.hpp>
+
+#include <iostream>
+#include <thread>
+#include <chrono>
+
+#include "t_config.hpp"
+#include "t_utils.hpp"
+
+
+using namespace std;
+using namespace conduit;
+using namespace ascent;
+
+//-----------------------------------------------------------------------------
+void
+busy_wait(double seconds)
+{
+    std::chrono::steady_clock::time_point start = 
+        std::chrono::steady_clock::now();
+    while(std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                        start).count() < seconds)
+    {
+        // spin
+    }
+}
+
+//-----------------------------------------------------------------------------
+// returns the index of the first trace event with the given name, or -1
+//-----------------------------------------------------------------------------
+index_t
+find_trace_event(const Node &events,
+                 const std::string &name)
+{
+    for(index_t i = 0; i < events.number_of_children(); i++)
+    {
+        const Node &e = events.child(i);
+        if(e.has_child("name") && e["name"].as_string() == name)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_block_timer, trace_file)
+{
+    string output_file = conduit::utils::join_file_path(output_dir(),
+                                                        "tout_block_timer_trace.json");
+    if(conduit::utils::is_file(output_file))
+    {
+        conduit::utils::remove_file(output_file);
+    }
+
+    BlockTimer::EnableTrace(output_file);
+    EXPECT_TRUE(BlockTimer::TraceEnabled());
+
+    {
+        BlockTimer outer("bt_trace_outer");
+        {
+            BlockTimer inner("bt_trace_inner");
+            busy_wait(0.002);
+        }
+    }
+
+    // a second thread shows up with its own tid
+    std::thread worker([]()
+                       {
+                           BlockTimer t("bt_trace_worker");
+                           busy_wait(0.001);
+                       });
+    worker.join();
+
+    BlockTimer::WriteTraceFile();
+    BlockTimer::DisableTrace();
+    EXPECT_FALSE(BlockTimer::TraceEnabled());
+
+    // not recorded w/o trace
+    {
+        BlockTimer t("bt_trace_disabled");
+    }
+
+    ASSERT_TRUE(conduit::utils::is_file(output_file));
+
+    Node trace;
+    trace.load(output_file,"json");
+    trace.print();
+
+    EXPECT_EQ(trace["displayTimeUnit"].as_string(),"ms");
+    const Node &events = trace["traceEvents"];
+
+    // rank 0 is named as a process
+    index_t meta_idx = find_trace_event(events,"process_name");
+    ASSERT_TRUE(meta_idx >= 0);
+    EXPECT_EQ(events.child(meta_idx)["ph"].as_string(),"M");
+    EXPECT_EQ(events.child(meta_idx)["pid"].to_int(),0);
+
+    index_t outer_idx  = find_trace_event(events,"bt_trace_outer");
+    index_t inner_idx  = find_trace_event(events,"bt_trace_inner");
+    index_t worker_idx = find_trace_event(events,"bt_trace_worker");
+    ASSERT_TRUE(outer_idx >= 0);
+    ASSERT_TRUE(inner_idx >= 0);
+    ASSERT_TRUE(worker_idx >= 0);
+    EXPECT_EQ(find_trace_event(events,"bt_trace_disabled"),-1);
+
+    const Node &outer  = events.child(outer_idx);
+    const Node &inner  = events.child(inner_idx);
+    const Node &worker_ev = events.child(worker_idx);
+
+    // complete events, in microseconds
+    EXPECT_EQ(outer["ph"].as_string(),"X");
+    EXPECT_EQ(inner["ph"].as_string(),"X");
+    EXPECT_EQ(worker_ev["ph"].as_string(),"X");
+
+    EXPECT_EQ(outer["pid"].to_int(),0);
+    EXPECT_EQ(inner["pid"].to_int(),0);
+    EXPECT_EQ(worker_ev["pid"].to_int(),0);
+
+    EXPECT_EQ(outer["tid"].to_int(),inner["tid"].to_int());
+    EXPECT_NE(outer["tid"].to_int(),worker_ev["tid"].to_int());
+
+    int64 outer_ts  = outer["ts"].to_int64();
+    int64 outer_dur = outer["dur"].to_int64();
+    int64 inner_ts  = inner["ts"].to_int64();
+    int64 inner_dur = inner["dur"].to_int64();
+
+    EXPECT_TRUE(outer_ts >= 0);
+    EXPECT_TRUE(inner_dur >= 2000);
+    // the inner block is nested in the outer one
+    EXPECT_TRUE(inner_ts >= outer_ts);
+    EXPECT_TRUE(inner_ts + inner_dur <= outer_ts + outer_dur);
+    // the worker ran after the outer block
+    EXPECT_TRUE(worker_ev["ts"].to_int64() >= outer_ts + outer_dur);
+    EXPECT_TRUE(worker_ev["dur"].to_int64() >= 1000);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_block_timer, threads_merged)
+{
+    const int num_threads = 4;
+    const int num_blocks  = 5;
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < num_threads; t++)
+    {
+        threads.push_back(std::thread([]()
+                          {
+                              for(int i = 0; i < num_blocks; i++)
+                              {
+                                  BlockTimer outer("bt_thread_outer");
+                                  BlockTimer inner("bt_thread_inner");
+                                  busy_wait(0.001);
+                              }
+                          }));
+    }
+
+    for(int t = 0; t < num_threads; t++)
+    {
+        threads[t].join();
+    }
+
+    // the hierarchies of all (finished) threads are merged by name
+    Node &root = BlockTimer::Finalize();
+    root.print();
+
+    ASSERT_TRUE(root.has_path("children/bt_thread_outer"));
+    const Node &outer = root["children/bt_thread_outer"];
+    ASSERT_TRUE(outer.has_path("children/bt_thread_inner"));
+    const Node &inner = outer["children/bt_thread_inner"];
+
+    EXPECT_EQ(outer["count"].to_int(),num_threads * num_blocks);
+    EXPECT_EQ(inner["count"].to_int(),num_threads * num_blocks);
+
+    // totals are summed over the threads
+    double min_total = num_threads * num_blocks * 0.001;
+    EXPECT_TRUE(inner["value"].to_float64() >= min_total);
+    EXPECT_TRUE(outer["value"].to_float64() >= inner["value"].to_float64());
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_block_timer, mismatched_stop)
+{
+    BlockTimer::StartTimer("bt_stop_outer");
+    BlockTimer::StartTimer("bt_stop_inner");
+    // does not match the innermost timer, ignored
+    BlockTimer::StopTimer("bt_stop_outer");
+    BlockTimer::StopTimer("bt_stop_inner");
+    BlockTimer::StopTimer("bt_stop_outer");
+    // nothing left to stop, ignored
+    BlockTimer::StopTimer("bt_stop_outer");
+
+    Node &root = BlockTimer::Finalize();
+
+    ASSERT_TRUE(root.has_path("children/bt_stop_outer/children/bt_stop_inner"));
+    EXPECT_EQ(root["children/bt_stop_outer/count"].to_int(),1);
+    EXPECT_EQ(root["children/bt_stop_outer/children/bt_stop_inner/count"].to_int(),1);
+
+    // timers started after the mismatch are at the top level again
+    {
+        BlockTimer t("bt_stop_after");
+    }
+    // (root refers to the finalized timers, which are updated in place)
+    BlockTimer::Finalize();
+    EXPECT_TRUE(root.has_path("children/bt_stop_after"));
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_block_timer, reduced_stats)
+{
+    for(int i = 0; i < 3; i++)
+    {
+        BlockTimer t("bt_stats");
+        busy_wait(0.001);
+    }
+
+    Node &root = BlockTimer::Finalize();
+    root["children/bt_stats"].print();
+
+    ASSERT_TRUE(root.has_path("children/bt_stats"));
+    const Node &stats = root["children/bt_stats"];
+
+    // with a single rank, the max, min and mean are this rank's total
+    double total = stats["value"].to_float64();
+    EXPECT_TRUE(total >= 0.003);
+    EXPECT_EQ(stats["id"].to_int(),0);
+    EXPECT_NEAR(stats["min"].to_float64(),total,1e-12);
+    EXPECT_EQ(stats["minid"].to_int(),0);
+    EXPECT_NEAR(stats["avg"].to_float64(),total,1e-12);
+    EXPECT_NEAR(stats["stddev"].to_float64(),0.0,1e-9);
+    EXPECT_NEAR(stats["imbalance"].to_float64(),1.0,1e-9);
+    EXPECT_EQ(stats["ranks"].to_int(),1);
+    EXPECT_EQ(stats["count"].to_int(),3);
+    EXPECT_TRUE(stats.has_child("sysMemUsed"));
+    EXPECT_TRUE(stats.has_child("procMemMB"));
+}
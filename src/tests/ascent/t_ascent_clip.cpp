@@ -162,6 +162,103 @@ TEST(ascent_clip, test_clip_sphere)
     EXPECT_TRUE(check_test_image(output_file));
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_clip, test_threshold_clip_sphere)
+{
+    // the ascent runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping 3D default"
+                      "Pipeline test");
+
+        return;
+    }
+    
+    
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+    
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+    verify_info.print();
+
+    ASCENT_INFO("Testing 3D Rendering of a Threshold followed by a Clip");
+
+
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path,"tout_threshold_clip_sphere");
+    
+    // remove old images before rendering
+    remove_test_image(output_file);
+
+
+    //
+    // Create the actions.
+    //
+    
+    conduit::Node pipelines;
+    // pipeline 1
+    pipelines["pl1/f1/type"] = "threshold";
+    // filter knobs
+    conduit::Node &thresh_params = pipelines["pl1/f1/params"];
+    thresh_params["field"] = "braid";
+    thresh_params["min_value"] = -0.2;
+    thresh_params["max_value"] = 0.2;
+
+    // the clip consumes the thresholded mesh
+    pipelines["pl1/f2/type"] = "clip";
+    conduit::Node &clip_params = pipelines["pl1/f2/params"];
+    clip_params["topology"] = "mesh";
+    clip_params["sphere/radius"] = 11.;
+    clip_params["sphere/center/x"] = 0.;
+    clip_params["sphere/center/y"] = 0.;
+    clip_params["sphere/center/z"] = 0.;
+
+    conduit::Node scenes;
+    scenes["s1/plots/p1/type"]         = "pseudocolor";
+    scenes["s1/plots/p1/params/field"] = "braid";
+    scenes["s1/plots/p1/pipeline"] = "pl1";
+    scenes["s1/image_prefix"] = output_file;
+ 
+    conduit::Node actions;
+    // add the pipeline
+    conduit::Node &add_pipelines= actions.append();
+    add_pipelines["action"] = "add_pipelines";
+    add_pipelines["pipelines"] = pipelines;
+    // add the scenes
+    conduit::Node &add_scenes= actions.append();
+    add_scenes["action"] = "add_scenes";
+    add_scenes["scenes"] = scenes;
+    // execute
+    conduit::Node &execute  = actions.append();
+    execute["action"] = "execute";
+    
+    //
+    // Run Ascent
+    //
+    
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+    ascent.close();
+    
+    // check that we created an image
+    EXPECT_TRUE(check_test_image(output_file));
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {
@@ -812,3 +812,69 @@ TEST(ascent_flow_runtime, test_flow_load_and_save_graph)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_runtime, test_flow_async_execute)
+{
+    string output_file = conduit::utils::join_file_path(output_dir(),
+                                                        "tout_flow_async_execute.json");
+    if(conduit::utils::is_file(output_file))
+    {
+        conduit::utils::remove_file(output_file);
+    }
+
+    Node actions;
+    actions.append();
+    actions[0]["action"] = "add_filter";
+    actions[0]["type_name"]  = "relay_io_save";
+    actions[0]["name"] = "out";
+    actions[0]["params/path"] = output_file;
+
+    actions.append();
+    actions[1]["action"] = "connect";
+    actions[1]["src"]  = "source";
+    actions[1]["dest"] = "out";
+
+    actions.append()["action"] = "execute";
+
+    // we want the "flow" runtime, executing in the background
+    Node open_opts;
+    open_opts["runtime/type"]  = "flow";
+    open_opts["async/enabled"] = "true";
+    open_opts["async/policy"]  = "wait";
+
+    //
+    // Create example mesh.
+    //
+    Node data;
+    conduit::blueprint::mesh::examples::braid("quads",10,10,0,data);
+    float64 *vals = data["fields/braid/values"].value();
+    float64 published_val = vals[0];
+
+    //
+    // Run Ascent
+    //
+    Ascent ascent;
+    ascent.open(open_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+
+    // publish takes a snapshot, so the simulation can move on
+    vals[0] = published_val + 1.0;
+
+    ascent.wait();
+
+    Node saved;
+    saved.load(output_file,"json");
+    EXPECT_NEAR(saved["fields/braid/values"].as_float64_ptr()[0],
+                published_val,
+                1e-6);
+
+    Node info;
+    ascent.info(info);
+    info.print();
+    EXPECT_EQ(info["async/executed"].to_int(),1);
+    EXPECT_EQ(info["async/policy"].as_string(),"wait");
+
+    ascent.close();
+}
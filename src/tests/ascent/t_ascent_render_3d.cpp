@@ -508,6 +508,575 @@ TEST(ascent_render_3d, test_render_3d_multi_render)
 
 
 
+//-----------------------------------------------------------------------------
+// creates a multi-domain mesh with num_domains braid domains side by 
+// side along x, optionally with explicit domain ids
+//-----------------------------------------------------------------------------
+void
+create_multi_domain_braid(int num_domains,
+                          bool with_domain_ids,
+                          Node &data)
+{
+    data.reset();
+    for(int d = 0; d < num_domains; d++)
+    {
+        Node &dom = data.append();
+        conduit::blueprint::mesh::examples::braid("uniform",
+                                                  EXAMPLE_MESH_SIDE_DIM,
+                                                  EXAMPLE_MESH_SIDE_DIM,
+                                                  EXAMPLE_MESH_SIDE_DIM,
+                                                  dom);
+        // braid spans [-10,10], move each domain next to the last
+        float64 origin_x = dom["coordsets/coords/origin/x"].to_float64();
+        dom["coordsets/coords/origin/x"] = origin_x + 20.0 * d;
+
+        if(with_domain_ids)
+        {
+            dom["state/domain_id"] = 10 + d;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+render_multi_domain_braid(const Node &data,
+                          const std::string &image_name)
+{
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path,image_name);
+    
+    // remove old images before rendering
+    remove_test_image(output_file);
+
+    //
+    // Create the actions.
+    //
+
+    conduit::Node scenes;
+    scenes["s1/plots/p1/type"]         = "pseudocolor";
+    scenes["s1/plots/p1/params/field"] = "braid";
+    scenes["s1/image_prefix"] = output_file;
+ 
+    conduit::Node actions;
+    conduit::Node &add_plots = actions.append();
+    add_plots["action"] = "add_scenes";
+    add_plots["scenes"] = scenes;
+    conduit::Node &execute  = actions.append();
+    execute["action"] = "execute";
+    
+    //
+    // Run Ascent
+    //
+    
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    // convert the domains concurrently
+    ascent_opts["runtime/threads"] = 2;
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+    ascent.close();
+    
+    // check that we created an image
+    EXPECT_TRUE(check_test_image(output_file));
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_render_3d, test_render_3d_multi_domain)
+{
+    // the ascent runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping 3D multi domain"
+                      "Pipeline test");
+
+        return;
+    }
+
+    //
+    // Create an example mesh, each domain lists its domain id
+    //
+    Node data, verify_info;
+    create_multi_domain_braid(3, true, data);
+    
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing 3D Rendering of a Multi Domain Mesh");
+
+    render_multi_domain_braid(data, "tout_render_3d_multi_domain");
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_render_3d, test_render_3d_multi_domain_default_ids)
+{
+    // the ascent runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping 3D multi domain"
+                      "Pipeline test");
+
+        return;
+    }
+
+    //
+    // Create an example mesh w/o domain ids, which are numbered
+    // by position and rank
+    //
+    Node data, verify_info;
+    create_multi_domain_braid(3, false, data);
+    
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing 3D Rendering of a Multi Domain Mesh w/o Domain Ids");
+
+    render_multi_domain_braid(data, "tout_render_3d_multi_domain_default_ids");
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(ascent_render_3d, test_render_3d_field_types)
+{
+    // the ascent runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping 3D field types"
+                      "Pipeline test");
+
+        return;
+    }
+    
+    //
+    // Create an example mesh, with copies of the radial field 
+    // in other types
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    const char *type_names[] = {"float32", "int32", "uint8"};
+    const index_t type_ids[] = {DataType::FLOAT32_ID, 
+                                DataType::INT32_ID, 
+                                DataType::UINT8_ID};
+
+    for(int t = 0; t < 3; t++)
+    {
+        std::string field_name = std::string("radial_") + type_names[t];
+        Node &field = data["fields/" + field_name];
+        field["association"] = data["fields/radial/association"].as_string();
+        field["topology"]    = data["fields/radial/topology"].as_string();
+        field["type"]        = "scalar";
+        data["fields/radial/values"].to_data_type(type_ids[t],
+                                                  field["values"]);
+    }
+    
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing 3D Rendering of float32, int32 and uint8 fields");
+
+    string output_path = prepare_output_dir();
+
+    //
+    // Create the actions, one scene per field type
+    //
+
+    conduit::Node scenes;
+    std::vector<std::string> output_files;
+    for(int t = 0; t < 3; t++)
+    {
+        std::string field_name = std::string("radial_") + type_names[t];
+        std::string output_file = 
+            conduit::utils::join_file_path(output_path,
+                                           "tout_render_3d_field_" + 
+                                           std::string(type_names[t]));
+        // remove old images before rendering
+        remove_test_image(output_file);
+        output_files.push_back(output_file);
+
+        Node &scene = scenes[std::string("s_") + type_names[t]];
+        scene["plots/p1/type"]         = "pseudocolor";
+        scene["plots/p1/params/field"] = field_name;
+        scene["image_prefix"] = output_file;
+    }
+ 
+    conduit::Node actions;
+    conduit::Node &add_plots = actions.append();
+    add_plots["action"] = "add_scenes";
+    add_plots["scenes"] = scenes;
+    conduit::Node &execute  = actions.append();
+    execute["action"] = "execute";
+    
+    //
+    // Run Ascent
+    //
+    
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+    ascent.close();
+    
+    // check that we created the images
+    for(size_t i = 0; i < output_files.size(); i++)
+    {
+        EXPECT_TRUE(check_test_image(output_files[i]));
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(ascent_render_3d, test_render_3d_strided_arrays)
+{
+    // the ascent runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping 3D strided arrays"
+                      "Pipeline test");
+
+        return;
+    }
+    
+    //
+    // Create an example mesh, and describe its coords and fields
+    // with strides and offsets
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+
+    Node &n_coords = data["coordsets/coords/values"];
+    const index_t nverts = n_coords["x"].dtype().number_of_elements();
+
+    // interleaved coords (x0,y0,z0,x1,...)
+    std::vector<float64> xyz(nverts * 3);
+    const char *axes[] = {"x", "y", "z"};
+    for(int a = 0; a < 3; a++)
+    {
+        float64_array vals = n_coords[axes[a]].value();
+        for(index_t i = 0; i < nverts; i++)
+        {
+            xyz[i * 3 + a] = vals[i];
+        }
+    }
+
+    for(int a = 0; a < 3; a++)
+    {
+        n_coords[axes[a]].set_external(DataType::float64(nverts,
+                                                         a * sizeof(float64),
+                                                         3 * sizeof(float64)),
+                                       &xyz[0]);
+    }
+
+    // braid values in an array of structs (value, padding)
+    float64_array braid_vals = data["fields/braid/values"].value();
+    std::vector<float64> braid_aos(nverts * 2, 0.0);
+    // braid values after a padding value
+    std::vector<float64> braid_offset(nverts + 1, 0.0);
+    for(index_t i = 0; i < nverts; i++)
+    {
+        braid_aos[i * 2]     = braid_vals[i];
+        braid_offset[i + 1]  = braid_vals[i];
+    }
+
+    data["fields/braid_aos"].set(data["fields/braid"]);
+    data["fields/braid_aos/values"].set_external(
+        DataType::float64(nverts, 0, 2 * sizeof(float64)),
+        &braid_aos[0]);
+
+    data["fields/braid_offset"].set(data["fields/braid"]);
+    data["fields/braid_offset/values"].set_external(
+        DataType::float64(nverts, sizeof(float64), sizeof(float64)),
+        &braid_offset[0]);
+
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing 3D Rendering of strided and offset arrays");
+
+    string output_path = prepare_output_dir();
+
+    //
+    // Create the actions, one scene per field
+    //
+
+    const char *field_names[] = {"braid_aos", "braid_offset"};
+    conduit::Node scenes;
+    std::vector<std::string> output_files;
+    for(int f = 0; f < 2; f++)
+    {
+        std::string output_file = 
+            conduit::utils::join_file_path(output_path,
+                                           "tout_render_3d_" + 
+                                           std::string(field_names[f]));
+        // remove old images before rendering
+        remove_test_image(output_file);
+        output_files.push_back(output_file);
+
+        Node &scene = scenes[std::string("s_") + field_names[f]];
+        scene["plots/p1/type"]         = "pseudocolor";
+        scene["plots/p1/params/field"] = field_names[f];
+        scene["image_prefix"] = output_file;
+    }
+ 
+    conduit::Node actions;
+    conduit::Node &add_plots = actions.append();
+    add_plots["action"] = "add_scenes";
+    add_plots["scenes"] = scenes;
+    conduit::Node &execute  = actions.append();
+    execute["action"] = "execute";
+    
+    //
+    // Run Ascent
+    //
+    
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+    ascent.close();
+    
+    // check that we created the images
+    for(size_t i = 0; i < output_files.size(); i++)
+    {
+        EXPECT_TRUE(check_test_image(output_files[i]));
+    }
+}
+
+
+
+//-----------------------------------------------------------------------------
+TEST(ascent_render_3d, test_render_3d_tets)
+{
+    // the ascent runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping 3D tets"
+                      "Pipeline test");
+
+        return;
+    }
+    
+    //
+    // Create an example mesh.
+    //
+    Node data, verify_info;
+    conduit::blueprint::mesh::examples::braid("tets",
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              EXAMPLE_MESH_SIDE_DIM,
+                                              data);
+    
+    EXPECT_TRUE(conduit::blueprint::mesh::verify(data,verify_info));
+
+    ASCENT_INFO("Testing 3D Rendering of a Tet Mesh");
+
+    string output_path = prepare_output_dir();
+    string output_file = conduit::utils::join_file_path(output_path,"tout_render_3d_tets");
+    
+    // remove old images before rendering
+    remove_test_image(output_file);
+
+    //
+    // Create the actions.
+    //
+
+    conduit::Node scenes;
+    scenes["s1/plots/p1/type"]         = "pseudocolor";
+    scenes["s1/plots/p1/params/field"] = "braid";
+    scenes["s1/image_prefix"] = output_file;
+ 
+    conduit::Node actions;
+    conduit::Node &add_plots = actions.append();
+    add_plots["action"] = "add_scenes";
+    add_plots["scenes"] = scenes;
+    conduit::Node &execute  = actions.append();
+    execute["action"] = "execute";
+    
+    //
+    // Run Ascent
+    //
+    
+    Ascent ascent;
+
+    Node ascent_opts;
+    ascent_opts["runtime/type"] = "ascent";
+    ascent.open(ascent_opts);
+    ascent.publish(data);
+    ascent.execute(actions);
+    ascent.close();
+    
+    // check that we created an image
+    EXPECT_TRUE(check_test_image(output_file));
+}
+
+//-----------------------------------------------------------------------------
+// creates a mesh with a hex, a pyramid on its +x face and a wedge on 
+// its +z face, using a mixed element topology. 
+//
+// if vtk_shape_ids is true, shapes are uint8 values that match the vtk-m
+// shape ids, otherwise they are int32 values with a different map
+//-----------------------------------------------------------------------------
+void
+create_mixed_shapes_mesh(bool vtk_shape_ids,
+                         bool with_offsets,
+                         Node &data)
+{
+    data.reset();
+
+    const float64 x[12] = {0, 1, 1, 0, 0, 1, 1, 0, 2.0, 0, 1, 0};
+    const float64 y[12] = {0, 0, 1, 1, 0, 0, 1, 1, 0.5, 0, 0, 1};
+    const float64 z[12] = {0, 0, 0, 0, 1, 1, 1, 1, 0.5, 2, 2, 2};
+
+    data["coordsets/coords/type"] = "explicit";
+    data["coordsets/coords/values/x"].set(x,12);
+    data["coordsets/coords/values/y"].set(y,12);
+    data["coordsets/coords/values/z"].set(z,12);
+
+    data["topologies/mesh/type"]     = "unstructured";
+    data["topologies/mesh/coordset"] = "coords";
+
+    Node &eles = data["topologies/mesh/elements"];
+    eles["shape"] = "mixed";
+
+    const int32 conn[19] = {0, 1, 2, 3, 4, 5, 6, 7, // hex
+                            1, 2, 6, 5, 8,          // pyramid
+                            4, 5, 7, 9, 10, 11};    // wedge
+    eles["connectivity"].set(conn,19);
+
+    if(vtk_shape_ids)
+    {
+        eles["shape_map/hex"]     = 12;
+        eles["shape_map/pyramid"] = 14;
+        eles["shape_map/wedge"]   = 13;
+        const uint8 shapes[3] = {12, 14, 13};
+        eles["shapes"].set(shapes,3);
+    }
+    else
+    {
+        eles["shape_map/hex"]     = 0;
+        eles["shape_map/pyramid"] = 1;
+        eles["shape_map/wedge"]   = 2;
+        const int32 shapes[3] = {0, 1, 2};
+        eles["shapes"].set(shapes,3);
+    }
+
+    const int32 sizes[3] = {8, 5, 6};
+    eles["sizes"].set(sizes,3);
+
+    if(with_offsets)
+    {
+        const int32 offsets[3] = {0, 8, 13};
+        eles["offsets"].set(offsets,3);
+    }
+
+    float64 vals[12];
+    for(int i = 0; i < 12; i++)
+    {
+        vals[i] = x[i] + y[i] + z[i];
+    }
+
+    data["fields/vals/association"] = "vertex";
+    data["fields/vals/topology"]    = "mesh";
+    data["fields/vals/type"]        = "scalar";
+    data["fields/vals/values"].set(vals,12);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_render_3d, test_render_3d_mixed_shapes)
+{
+    // the ascent runtime is currently our only rendering runtime
+    Node n;
+    ascent::about(n);
+    // only run this test if ascent was built with vtkm support
+    if(n["runtimes/ascent/status"].as_string() == "disabled")
+    {
+        ASCENT_INFO("Ascent support disabled, skipping 3D mixed shapes"
+                      "Pipeline test");
+
+        return;
+    }
+
+    ASCENT_INFO("Testing 3D Rendering of Mixed Element Shapes");
+
+    string output_path = prepare_output_dir();
+
+    // vtk shape ids w/ offsets, other shape ids w/ and w/o offsets
+    const bool vtk_shape_ids[3] = {true, false, false};
+    const bool with_offsets[3]  = {true, true, false};
+    const char *image_names[3]  = {"tout_render_3d_mixed_shapes_vtk_ids",
+                                   "tout_render_3d_mixed_shapes",
+                                   "tout_render_3d_mixed_shapes_no_offsets"};
+
+    for(int c = 0; c < 3; c++)
+    {
+        Node data;
+        create_mixed_shapes_mesh(vtk_shape_ids[c], with_offsets[c], data);
+
+        string output_file = conduit::utils::join_file_path(output_path,
+                                                            image_names[c]);
+        // remove old images before rendering
+        remove_test_image(output_file);
+
+        //
+        // Create the actions.
+        //
+
+        conduit::Node scenes;
+        scenes["s1/plots/p1/type"]         = "pseudocolor";
+        scenes["s1/plots/p1/params/field"] = "vals";
+        scenes["s1/image_prefix"] = output_file;
+     
+        conduit::Node actions;
+        conduit::Node &add_plots = actions.append();
+        add_plots["action"] = "add_scenes";
+        add_plots["scenes"] = scenes;
+        conduit::Node &execute  = actions.append();
+        execute["action"] = "execute";
+        
+        //
+        // Run Ascent
+        //
+        
+        Ascent ascent;
+
+        Node ascent_opts;
+        ascent_opts["runtime/type"] = "ascent";
+        ascent.open(ascent_opts);
+        ascent.publish(data);
+        ascent.execute(actions);
+        ascent.close();
+        
+        // check that we created an image
+        EXPECT_TRUE(check_test_image(output_file));
+    }
+}
 
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
@@ -0,0 +1,273 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-716457
+// 
+// All rights reserved.
+// 
+// This file is part of Ascent. 
+// 
+// For details, see: http://software.llnl.gov/ascent/.
+// 
+// Please also read ascent/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_flow_cache.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <flow.hpp>
+#include <flow_builtin_filters.hpp>
+
+#include <iostream>
+#include <math.h>
+
+#include "t_config.hpp"
+
+
+using namespace std;
+using namespace conduit;
+using namespace flow;
+
+//-----------------------------------------------------------------------------
+void
+store_value(Cache &c,
+            const std::string &name,
+            uint64 key,
+            int val)
+{
+    Node *n = new Node();
+    n->set(val);
+    DataWrapper<Node> data(n);
+    EXPECT_TRUE(c.store(name, key, data, 100));
+}
+
+//-----------------------------------------------------------------------------
+void
+no_evict(const std::string &, Data &)
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_cache, basic)
+{
+    Cache c;
+    EXPECT_EQ(c.max_bytes(),-1);
+
+    store_value(c,"a",1,10);
+    store_value(c,"b",2,20);
+
+    EXPECT_EQ(c.number_of_entries(),2);
+    EXPECT_EQ(c.bytes(),200);
+
+    // pin requires a matching key
+    EXPECT_TRUE(c.pin("a",1));
+    EXPECT_FALSE(c.pin("a",2));
+    EXPECT_FALSE(c.pin("c",1));
+
+    EXPECT_EQ(c.fetch("a")->value<Node>()->to_int(),10);
+    EXPECT_TRUE(c.fetch("c") == NULL);
+
+    // replace b
+    store_value(c,"b",3,30);
+    EXPECT_EQ(c.number_of_entries(),2);
+    EXPECT_FALSE(c.pin("b",2));
+    EXPECT_TRUE(c.pin("b",3));
+    EXPECT_EQ(c.fetch("b")->value<Node>()->to_int(),30);
+
+    Node info;
+    c.info(info);
+    info.print();
+    EXPECT_EQ(info["hits"].to_int(),2);
+    EXPECT_EQ(info["misses"].to_int(),3);
+
+    std::set<std::string> names;
+    names.insert("b");
+    c.retain_only(names);
+    EXPECT_EQ(c.number_of_entries(),1);
+    EXPECT_TRUE(c.fetch("a") == NULL);
+
+    c.clear();
+    EXPECT_EQ(c.number_of_entries(),0);
+    EXPECT_EQ(c.bytes(),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_cache, lru_eviction)
+{
+    Cache c;
+    c.set_max_bytes(250);
+
+    store_value(c,"a",1,10);
+    store_value(c,"b",1,20);
+    store_value(c,"c",1,30);
+
+    // stored outputs are pinned
+    c.trim(no_evict);
+    EXPECT_EQ(c.number_of_entries(),3);
+
+    // use a, so b is the least recently used
+    c.unpin_all();
+    c.fetch("a");
+
+    std::vector<std::string> evicted;
+    c.trim([&evicted](const std::string &name, Data &)
+           {
+               evicted.push_back(name);
+           });
+
+    EXPECT_EQ(evicted.size(),(size_t)1);
+    EXPECT_EQ(evicted[0],"b");
+    EXPECT_EQ(c.number_of_entries(),2);
+    EXPECT_EQ(c.bytes(),200);
+
+    // outputs larger than the budget are not retained
+    Node n;
+    DataWrapper<Node> data(&n);
+    EXPECT_FALSE(c.store("d",1,data,500));
+    EXPECT_TRUE(c.fetch("d") == NULL);
+
+    // 0 disables the cache
+    c.set_max_bytes(0);
+    EXPECT_FALSE(c.store("d",1,data,1));
+
+    EXPECT_THROW(c.set_max_bytes(-2),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+class CacheFieldFilter: public Filter
+{
+public:
+    CacheFieldFilter()
+    : Filter()
+    {}
+        
+    virtual ~CacheFieldFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "cache_field";
+        i["output_port"] = "true";
+        i["port_names"].append().set("in");
+        i["cacheable"]   = "true";
+        i["default_params"]["field"] = "";
+    }
+
+    virtual void declare_dependencies(Node &deps)
+    {
+        deps.append() = "fields/" + params()["field"].as_string();
+    }
+
+    virtual void execute()
+    {
+        std::string field = params()["field"].as_string();
+
+        Node *in  = input<Node>("in");
+        Node *res = new Node();
+        res->set(in->fetch("fields/" + field).to_int());
+        set_output<Node>(res);
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_cache, workspace_eviction_wo_registry_reset)
+{
+    Workspace::register_filter_type<filters::RegistrySource>();
+    Workspace::register_filter_type<CacheFieldFilter>();
+
+    Workspace w;
+    // room for one int32 output
+    w.cache().set_max_bytes(6);
+
+    Node data;
+    data["fields/p"] = 1;
+    data["fields/q"] = 2;
+
+    Node p;
+    p["entry"] = ":src";
+    w.graph().add_filter("registry_source","s",p);
+
+    p.reset();
+    p["field"] = "p";
+    w.graph().add_filter("cache_field","a",p);
+    p["field"] = "q";
+    w.graph().add_filter("cache_field","b",p);
+
+    w.graph().connect("s","a","in");
+    w.graph().connect("s","b","in");
+
+    Node gens;
+    gens["fields/p"] = 1;
+    gens["fields/q"] = 1;
+
+    w.registry().add<Node>(":src",&data);
+
+    int num_pointers = -1;
+
+    for(int i = 0; i < 4; i++)
+    {
+        // q changes each execute, and the cache evicts the least 
+        // recently used output at the start of each execute
+        data["fields/q"] = 2 + i;
+        gens["fields/q"] = 1 + i;
+        w.set_generations(gens);
+        w.execute();
+
+        EXPECT_EQ(w.registry().fetch<Node>("a")->to_int(),1);
+        EXPECT_EQ(w.registry().fetch<Node>("b")->to_int(),2 + i);
+
+        // outputs handed to the cache must not leave stale values 
+        // behind in the registry
+        Node info;
+        w.registry().info(info);
+        if(num_pointers < 0)
+        {
+            num_pointers = info["pointers"].number_of_children();
+        }
+        EXPECT_EQ(info["pointers"].number_of_children(),num_pointers);
+    }
+
+    Node info;
+    w.cache().info(info);
+    info.print();
+    EXPECT_TRUE(info["evictions"].to_int() > 0);
+
+    w.registry().reset();
+    Workspace::clear_supported_filter_types();
+}
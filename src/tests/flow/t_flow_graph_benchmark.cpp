@@ -0,0 +1,317 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2017, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-716457
+// 
+// All rights reserved.
+// 
+// This file is part of Ascent. 
+// 
+// For details, see: http://software.llnl.gov/ascent/.
+// 
+// Please also read ascent/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_flow_graph_benchmark.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <flow.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <chrono>
+
+#include "t_config.hpp"
+#include "t_utils.hpp"
+
+
+
+using namespace std;
+using namespace conduit;
+using namespace ascent;
+using namespace flow;
+
+// number of filters in the benchmark graphs
+const int NUM_FILTERS = 10000;
+
+//-----------------------------------------------------------------------------
+class SrcFilter: public Filter
+{
+public:
+    SrcFilter()
+    : Filter()
+    {}
+        
+    virtual ~SrcFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "src";
+        i["output_port"] = "true";
+        i["port_names"] = DataType::empty();
+    }
+
+    virtual void execute()
+    {
+        set_output<int>(new int(0));
+    }
+};
+
+//-----------------------------------------------------------------------------
+class IncFilter: public Filter
+{
+public:
+    IncFilter()
+    : Filter()
+    {}
+
+    virtual ~IncFilter()
+    {}
+           
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "inc";
+        i["output_port"] = "true";
+        i["port_names"].append().set("in");
+    }
+
+    virtual void execute()
+    {
+        set_output<int>(new int(*input<int>("in") + 1));
+    }
+};
+
+//-----------------------------------------------------------------------------
+class AddFilter: public Filter
+{
+public:
+    AddFilter()
+    : Filter()
+    {}
+        
+    virtual ~AddFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "add";
+        i["output_port"] = "true";
+        i["port_names"].append().set("a");
+        i["port_names"].append().set("b");        
+    }
+
+    virtual void execute()
+    {
+        set_output<int>(new int(*input<int>("a") + *input<int>("b")));
+    }
+};
+
+//-----------------------------------------------------------------------------
+// logging level to restore after the benchmarks
+int saved_log_level = flow::logging::LEVEL_INFO;
+
+//-----------------------------------------------------------------------------
+double
+elapsed_seconds(const std::chrono::steady_clock::time_point &start)
+{
+    std::chrono::duration<double> dt = std::chrono::steady_clock::now() - start;
+    return dt.count();
+}
+
+//-----------------------------------------------------------------------------
+std::string
+filter_name(const std::string &prefix, int idx)
+{
+    ostringstream oss;
+    oss << prefix << idx;
+    return oss.str();
+}
+
+//-----------------------------------------------------------------------------
+void
+register_filters()
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<IncFilter>();
+    Workspace::register_filter_type<AddFilter>();
+    // keep any info or debug output out of the timings
+    saved_log_level = flow::logging::level();
+    flow::logging::set_level(flow::logging::LEVEL_WARN);
+}
+
+//-----------------------------------------------------------------------------
+void
+clear_filters()
+{
+    flow::logging::set_level(saved_log_level);
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+// runs the timed phases that are shared by the benchmarks
+//-----------------------------------------------------------------------------
+void
+benchmark_graph(Workspace &w,
+                const std::string &res_name,
+                int expected)
+{
+    std::chrono::steady_clock::time_point start;
+
+    // first execute compiles the plan
+    start = std::chrono::steady_clock::now();
+    w.execute();
+    double t_exec = elapsed_seconds(start);
+
+    EXPECT_EQ(*w.registry().fetch<int>(res_name),expected);
+    w.registry().consume(res_name);
+
+    // second execute reuses it
+    start = std::chrono::steady_clock::now();
+    w.execute();
+    double t_exec_cached = elapsed_seconds(start);
+
+    EXPECT_EQ(*w.registry().fetch<int>(res_name),expected);
+    w.registry().consume(res_name);
+
+    start = std::chrono::steady_clock::now();
+    Node traversals;
+    w.traversals(traversals);
+    double t_travs = elapsed_seconds(start);
+
+    EXPECT_TRUE(traversals.number_of_children() > 0);
+
+    start = std::chrono::steady_clock::now();
+    Node info;
+    w.graph().info(info);
+    double t_info = elapsed_seconds(start);
+
+    EXPECT_EQ(info["filters"].number_of_children(),NUM_FILTERS);
+
+    start = std::chrono::steady_clock::now();
+    std::string dot = w.graph().to_dot();
+    double t_dot = elapsed_seconds(start);
+
+    EXPECT_FALSE(dot.empty());
+
+    std::cout << "  execute (compile plan): " << t_exec        << " s" << std::endl
+              << "  execute (cached plan):  " << t_exec_cached << " s" << std::endl
+              << "  traversals:             " << t_travs       << " s" << std::endl
+              << "  info:                   " << t_info        << " s" << std::endl
+              << "  to_dot:                 " << t_dot         << " s" << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_graph_benchmark, linear_graph_10k)
+{
+    register_filters();
+
+    Workspace w;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // src -> inc -> inc -> ... 
+    w.graph().add_filter("src","f0");
+    for(int i = 1; i < NUM_FILTERS; i++)
+    {
+        w.graph().add_filter("inc",filter_name("f",i));
+        w.graph().connect(filter_name("f",i-1),filter_name("f",i),"in");
+    }
+
+    std::cout << "linear graph with " << NUM_FILTERS << " filters" << std::endl
+              << "  construct:              " << elapsed_seconds(start) 
+              << " s" << std::endl;
+
+    benchmark_graph(w,filter_name("f",NUM_FILTERS-1),NUM_FILTERS-1);
+
+    clear_filters();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_graph_benchmark, fan_out_reduce_graph_10k)
+{
+    register_filters();
+
+    Workspace w;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // one src feeding a wide layer of incs, which are summed 
+    // with a binary tree of adds
+    const int num_leaves = NUM_FILTERS / 2;
+
+    w.graph().add_filter("src","s");
+
+    std::vector<std::string> level;
+    for(int i = 0; i < num_leaves; i++)
+    {
+        std::string name = filter_name("i",i);
+        w.graph().add_filter("inc",name);
+        w.graph().connect("s",name,"in");
+        level.push_back(name);
+    }
+
+    int num_adds = 0;
+    while(level.size() > 1)
+    {
+        std::vector<std::string> next_level;
+        for(size_t i = 0; i + 1 < level.size(); i += 2)
+        {
+            std::string name = filter_name("a",num_adds++);
+            w.graph().add_filter("add",name);
+            w.graph().connect(level[i],name,"a");
+            w.graph().connect(level[i+1],name,"b");
+            next_level.push_back(name);
+        }
+
+        if(level.size() % 2 == 1)
+        {
+            next_level.push_back(level.back());
+        }
+
+        level = next_level;
+    }
+
+    std::cout << "fan out reduce graph with " << NUM_FILTERS << " filters" << std::endl
+              << "  construct:              " << elapsed_seconds(start) 
+              << " s" << std::endl;
+
+    benchmark_graph(w,level[0],num_leaves);
+
+    clear_filters();
+}
@@ -210,5 +210,111 @@ TEST(ascent_flow_registry, detach_tracked)
     delete n;
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_registry, forget)
+{
+    Node *n = new Node();
+    n->set(10);
+
+    Registry r;
+    r.add<Node>("d",n,1);
+    r.add<Node>("d_al",n,1);
+
+    // d_al still refers to n
+    r.forget("d");
+    EXPECT_FALSE(r.has_entry("d"));
+
+    Node info;
+    r.info(info);
+    EXPECT_EQ(info["pointers"].number_of_children(),1);
+
+    // no entry refers to n, its address is no longer tracked
+    r.forget("d_al");
+    r.info(info);
+    EXPECT_EQ(info["entries"].number_of_children(),0);
+    EXPECT_EQ(info["pointers"].number_of_children(),0);
+
+    // the address can be reused w/o picking up the old value
+    r.add<Node>("e",n,1);
+    r.consume("e");
+    EXPECT_FALSE(r.has_entry("e"));
+    r.info(info);
+    EXPECT_EQ(info["pointers"].number_of_children(),0);
+}
+
+
 
 
+//-----------------------------------------------------------------------------
+// counts how many instances were deleted 
+//-----------------------------------------------------------------------------
+class ReleaseCounter
+{
+public:
+    ReleaseCounter()
+    {}
+    
+    ~ReleaseCounter()
+    {
+        num_released++;
+    }
+
+    static int num_released;
+};
+
+int ReleaseCounter::num_released = 0;
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_registry, many_entries_reuse_after_reset)
+{
+    // use enough entries to grow the hash tables and the entry pools
+    const int num_entries = 1000;
+
+    Registry r;
+
+    for(int cycle = 0; cycle < 3; cycle++)
+    {
+        ReleaseCounter::num_released = 0;
+
+        std::vector<ReleaseCounter*> ptrs;
+        for(int i = 0; i < num_entries; i++)
+        {
+            ostringstream oss;
+            oss << "d_" << i;
+            ReleaseCounter *ptr = new ReleaseCounter();
+            ptrs.push_back(ptr);
+            r.add<ReleaseCounter>(oss.str(),ptr,1);
+        }
+
+        for(int i = 0; i < num_entries; i++)
+        {
+            ostringstream oss;
+            oss << "d_" << i;
+            EXPECT_TRUE(r.has_entry(oss.str()));
+            EXPECT_EQ(r.fetch<ReleaseCounter>(oss.str()),ptrs[i]);
+        }
+
+        // consume half, which releases them
+        for(int i = 0; i < num_entries; i += 2)
+        {
+            ostringstream oss;
+            oss << "d_" << i;
+            r.consume(oss.str());
+            EXPECT_FALSE(r.has_entry(oss.str()));
+        }
+
+        EXPECT_EQ(ReleaseCounter::num_released, num_entries / 2);
+
+        for(int i = 1; i < num_entries; i += 2)
+        {
+            ostringstream oss;
+            oss << "d_" << i;
+            EXPECT_EQ(r.fetch<ReleaseCounter>(oss.str()),ptrs[i]);
+        }
+
+        // reset releases the rest
+        r.reset();
+        EXPECT_EQ(ReleaseCounter::num_released, num_entries);
+        EXPECT_FALSE(r.has_entry("d_1"));
+    }
+}
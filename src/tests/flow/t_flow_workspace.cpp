@@ -740,3 +740,712 @@ TEST(ascent_flow_workspace, dag_graph_missing_input_error)
 
     Workspace::clear_supported_filter_types();
 }
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, dag_graph_threaded)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<IncFilter>();
+    Workspace::register_filter_type<AddFilter>();
+
+    Workspace w;
+    w.set_number_of_threads(4);
+    EXPECT_EQ(w.number_of_threads(),4);
+
+    Node p_vs;
+    p_vs["value"].set(int(10));
+
+    // 8 independent src -> inc -> inc branches, summed
+    // by a chain of add filters
+    std::string prev_name;
+    for(int i = 0; i < 8; i++)
+    {
+        ostringstream oss;
+        oss << i;
+        std::string idx = oss.str();
+        
+        w.graph().add_filter("src","v" + idx,p_vs);
+        w.graph().add_filter("inc","a" + idx);
+        w.graph().add_filter("inc","b" + idx);
+        
+        w.graph().connect("v" + idx,"a" + idx,"in");
+        w.graph().connect("a" + idx,"b" + idx,"in");
+
+        if(i == 0)
+        {
+            prev_name = "b" + idx;
+        }
+        else
+        {
+            w.graph().add_filter("add","s" + idx);
+            w.graph().connect(prev_name,"s" + idx,"a");
+            w.graph().connect("b" + idx,"s" + idx,"b");
+            prev_name = "s" + idx;
+        }
+    }
+
+    w.execute();
+    
+    Node *res = w.registry().fetch<Node>(prev_name);
+    
+    ASCENT_INFO("Final result: " << res->to_json());
+    
+    EXPECT_EQ(res->to_int(),8 * 12);
+    
+    w.registry().consume(prev_name);
+
+    // execute again to make sure the result is stable
+    w.execute();
+    res = w.registry().fetch<Node>(prev_name);
+    EXPECT_EQ(res->to_int(),8 * 12);
+    w.registry().consume(prev_name);
+
+    EXPECT_THROW(w.set_number_of_threads(0),conduit::Error);
+
+    Workspace::clear_supported_filter_types();
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, cached_plan)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<IncFilter>();
+
+    Workspace w;
+
+    EXPECT_EQ(w.graph().version(),0);
+
+    Node p_vs;
+    p_vs["value"].set(int(10));
+
+    Filter *f_s = w.graph().add_filter("src","s",p_vs);
+    w.graph().add_filter("inc","a");
+    w.graph().connect("s","a","in");
+
+    uint64 version = w.graph().version();
+    EXPECT_TRUE(version > 0);
+
+    w.execute();
+    EXPECT_EQ(w.registry().fetch<Node>("a")->to_int(),11);
+    w.registry().consume("a");
+
+    // executing does not change the graph, and param changes 
+    // are picked up by the cached plan
+    EXPECT_EQ(w.graph().version(),version);
+    f_s->params()["value"] = 20;
+
+    w.execute();
+    EXPECT_EQ(w.graph().version(),version);
+    EXPECT_EQ(w.registry().fetch<Node>("a")->to_int(),21);
+    w.registry().consume("a");
+
+    // extending the graph invalidates the plan
+    w.graph().add_filter("inc","b");
+    w.graph().connect("a","b","in");
+    EXPECT_TRUE(w.graph().version() > version);
+
+    w.execute();
+    EXPECT_EQ(w.registry().fetch<Node>("b")->to_int(),22);
+    w.registry().consume("b");
+
+    // so does removing filters
+    w.graph().add_filter("inc","c");
+    version = w.graph().version();
+    w.graph().remove_filter("c");
+    EXPECT_TRUE(w.graph().version() > version);
+
+    w.execute();
+    EXPECT_EQ(w.registry().fetch<Node>("b")->to_int(),22);
+    w.registry().consume("b");
+
+    // and resetting 
+    version = w.graph().version();
+    w.reset();
+    EXPECT_TRUE(w.graph().version() > version);
+
+    w.graph().add_filter("src","s",p_vs);
+    w.execute();
+    EXPECT_EQ(w.registry().fetch<Node>("s")->to_int(),10);
+    w.registry().consume("s");
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+int log_msg_count = 0;
+
+//-----------------------------------------------------------------------------
+std::string
+counted_log_msg()
+{
+    log_msg_count++;
+    return "counted message";
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, logging_levels)
+{
+    EXPECT_EQ(logging::level(),(int)logging::LEVEL_INFO);
+
+    // disabled levels don't construct messages
+    logging::set_level(logging::LEVEL_WARN);
+    FLOW_INFO(counted_log_msg());
+    FLOW_DEBUG(counted_log_msg());
+    EXPECT_EQ(log_msg_count,0);
+
+    logging::set_level(logging::LEVEL_INFO);
+    FLOW_INFO(counted_log_msg());
+    FLOW_DEBUG(counted_log_msg());
+    EXPECT_EQ(log_msg_count,1);
+
+    logging::set_level(logging::LEVEL_DEBUG);
+    FLOW_INFO(counted_log_msg());
+    FLOW_DEBUG(counted_log_msg());
+    EXPECT_EQ(log_msg_count,3);
+
+    EXPECT_THROW(logging::set_level(42),conduit::Error);
+
+    logging::set_level(logging::LEVEL_INFO);
+}
+
+//-----------------------------------------------------------------------------
+int scale_exec_count = 0;
+
+//-----------------------------------------------------------------------------
+class ScaleFieldFilter: public Filter
+{
+public:
+    ScaleFieldFilter()
+    : Filter()
+    {}
+        
+    virtual ~ScaleFieldFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "scale_field";
+        i["output_port"] = "true";
+        i["port_names"].append().set("in");
+        i["cacheable"]   = "true";
+        i["default_params"]["field"] = "";
+        i["default_params"]["scale"].set((int)2);
+    }
+
+    virtual void declare_dependencies(Node &deps)
+    {
+        deps.append() = "fields/" + params()["field"].as_string();
+    }
+
+    virtual void execute()
+    {
+        scale_exec_count++;
+
+        std::string field = params()["field"].as_string();
+        int scale = params()["scale"].value();
+
+        Node *in  = input<Node>("in");
+        Node *res = new Node();
+        res->set(in->fetch("fields/" + field).to_int() * scale);
+        set_output<Node>(res);
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, incremental_execution)
+{
+    Workspace::register_filter_type<filters::RegistrySource>();
+    Workspace::register_filter_type<ScaleFieldFilter>();
+
+    Workspace w;
+
+    Node data;
+    data["fields/p"] = 1;
+    data["fields/q"] = 2;
+
+    Node p;
+    p["entry"] = ":src";
+    w.graph().add_filter("registry_source","s",p);
+
+    p.reset();
+    p["field"] = "p";
+    Filter *f_sp = w.graph().add_filter("scale_field","sp",p);
+    p["field"] = "q";
+    w.graph().add_filter("scale_field","sq",p);
+
+    w.graph().connect("s","sp","in");
+    w.graph().connect("s","sq","in");
+
+    Node gens;
+    gens["fields/p"] = 1;
+    gens["fields/q"] = 1;
+
+    // first execute runs everything
+    w.registry().add<Node>(":src",&data);
+    w.set_generations(gens);
+    w.execute();
+    EXPECT_EQ(scale_exec_count,2);
+    EXPECT_EQ(w.registry().fetch<Node>("sp")->to_int(),2);
+    EXPECT_EQ(w.registry().fetch<Node>("sq")->to_int(),4);
+    w.registry().reset();
+
+    // only q changed
+    data["fields/q"] = 3;
+    gens["fields/q"] = 2;
+    w.registry().add<Node>(":src",&data);
+    w.set_generations(gens);
+    w.execute();
+    EXPECT_EQ(scale_exec_count,3);
+    EXPECT_EQ(w.registry().fetch<Node>("sp")->to_int(),2);
+    EXPECT_EQ(w.registry().fetch<Node>("sq")->to_int(),6);
+    w.registry().reset();
+
+    // nothing changed, but params did
+    f_sp->params()["scale"] = 3;
+    w.registry().add<Node>(":src",&data);
+    w.set_generations(gens);
+    w.execute();
+    EXPECT_EQ(scale_exec_count,4);
+    EXPECT_EQ(w.registry().fetch<Node>("sp")->to_int(),3);
+    EXPECT_EQ(w.registry().fetch<Node>("sq")->to_int(),6);
+    w.registry().reset();
+
+    // w/o generations everything is considered changed
+    w.registry().add<Node>(":src",&data);
+    w.execute();
+    EXPECT_EQ(scale_exec_count,6);
+    w.registry().reset();
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+class SelectFieldsFilter: public Filter
+{
+public:
+    SelectFieldsFilter()
+    : Filter()
+    {}
+        
+    virtual ~SelectFieldsFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "select_fields";
+        i["output_port"] = "true";
+        i["port_names"].append().set("in");
+        i["generations"] = "forward";
+    }
+
+    virtual void execute()
+    {
+        Node *in  = input<Node>("in");
+        Node *res = new Node();
+        NodeConstIterator itr = params()["fields"].children();
+        while(itr.has_next())
+        {
+            std::string path = "fields/" + itr.next().as_string();
+            (*res)[path].set(in->fetch(path));
+        }
+        set_output<Node>(res);
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, incremental_execution_forward_params)
+{
+    scale_exec_count = 0;
+
+    Workspace::register_filter_type<filters::RegistrySource>();
+    Workspace::register_filter_type<SelectFieldsFilter>();
+    Workspace::register_filter_type<ScaleFieldFilter>();
+
+    Workspace w;
+
+    Node data;
+    data["fields/p"] = 1;
+    data["fields/q"] = 2;
+
+    Node p;
+    p["entry"] = ":src";
+    w.graph().add_filter("registry_source","s",p);
+
+    p.reset();
+    p["fields"].append() = "p";
+    Filter *f_sel = w.graph().add_filter("select_fields","sel",p);
+
+    p.reset();
+    p["field"] = "p";
+    w.graph().add_filter("scale_field","sp",p);
+
+    w.graph().connect("s","sel","in");
+    w.graph().connect("sel","sp","in");
+
+    Node gens;
+    gens["fields/p"] = 1;
+    gens["fields/q"] = 1;
+
+    w.registry().add<Node>(":src",&data);
+    w.set_generations(gens);
+    w.execute();
+    EXPECT_EQ(scale_exec_count,1);
+    w.registry().reset();
+
+    // nothing changed
+    w.registry().add<Node>(":src",&data);
+    w.set_generations(gens);
+    w.execute();
+    EXPECT_EQ(scale_exec_count,1);
+    w.registry().reset();
+
+    // the data didn't change, but the forwarded fields did
+    f_sel->params()["fields"].append() = "q";
+    w.registry().add<Node>(":src",&data);
+    w.set_generations(gens);
+    w.execute();
+    EXPECT_EQ(scale_exec_count,2);
+    EXPECT_EQ(w.registry().fetch<Node>("sp")->to_int(),2);
+    w.registry().reset();
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, profiling)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<IncFilter>();
+
+    Workspace w;
+    EXPECT_FALSE(w.profiling());
+
+    Node p_vs;
+    p_vs["value"].set(int(10));
+
+    w.graph().add_filter("src","s",p_vs);
+    w.graph().add_filter("inc","a");
+    w.graph().add_filter("inc","b");
+    w.graph().connect("s","a","in");
+    w.graph().connect("a","b","in");
+
+    w.set_profiling(true);
+    w.execute();
+    EXPECT_EQ(w.registry().fetch<Node>("b")->to_int(),12);
+    w.registry().consume("b");
+
+    Node prof;
+    w.profile(prof);
+    prof.print();
+
+    EXPECT_EQ(prof["execute_count"].to_int(),1);
+    EXPECT_EQ(prof["filters"].number_of_children(),3);
+    EXPECT_EQ(prof["filters/a/type_name"].as_string(),"inc");
+    EXPECT_EQ(prof["filters/a/action"].as_string(),"run");
+    EXPECT_EQ(prof["filters/a/output_type"].as_string(),"conduit::Node");
+    EXPECT_TRUE(prof["filters/a/execute_time"].to_float64() >= 0.0);
+    // s is released after a consumes it, so at most two 
+    // outputs are held at once
+    EXPECT_EQ(prof["registry/high_water/entries"].to_int(),2);
+
+    Node info;
+    w.info(info);
+    EXPECT_TRUE(info.has_child("profile"));
+
+    w.set_profiling(false);
+    w.execute();
+    w.profile(prof);
+    EXPECT_TRUE(prof.dtype().is_empty());
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+class BigFilter: public Filter
+{
+public:
+    BigFilter()
+    : Filter()
+    {}
+        
+    virtual ~BigFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "big";
+        i["output_port"] = "true";
+        i["port_names"].append().set("in");
+        i["default_params"]["size"].set((int)1000);
+    }
+
+    virtual void execute()
+    {
+        int size = params()["size"].value();
+
+        Node *res = new Node();
+        res->set(DataType::int64(size));
+        set_output<Node>(res);
+    }
+};
+
+//-----------------------------------------------------------------------------
+class CountFilter: public Filter
+{
+public:
+    CountFilter()
+    : Filter()
+    {}
+        
+    virtual ~CountFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "count";
+        i["output_port"] = "true";
+        i["port_names"].append().set("in");
+    }
+
+    virtual void execute()
+    {
+        Node *in  = input<Node>("in");
+        Node *res = new Node();
+        res->set((int)in->dtype().number_of_elements());
+        set_output<Node>(res);
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, memory_ordering)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<BigFilter>();
+    Workspace::register_filter_type<CountFilter>();
+    Workspace::register_filter_type<AddFilter>();
+
+    Workspace w;
+    EXPECT_EQ(w.ordering(),"plan");
+    EXPECT_THROW(w.set_ordering("fastest"),conduit::Error);
+
+    // the traversal from sink "a" leaves b1 alive (k1 still needs it)
+    // while the traversal from sink "z" creates b2
+    w.graph().add_filter("src","s");
+    w.graph().add_filter("big","b1");
+    w.graph().add_filter("big","b2");
+    w.graph().add_filter("count","a");
+    w.graph().add_filter("count","k1");
+    w.graph().add_filter("count","k2");
+    w.graph().add_filter("add","z");
+
+    w.graph().connect("s","b1","in");
+    w.graph().connect("s","b2","in");
+    w.graph().connect("b1","a","in");
+    w.graph().connect("b1","k1","in");
+    w.graph().connect("b2","k2","in");
+    w.graph().connect("k2","z","a");
+    w.graph().connect("k1","z","b");
+
+    w.set_ordering("memory");
+
+    for(int threads = 1; threads <= 2; threads++)
+    {
+        w.set_number_of_threads(threads);
+
+        // sizes measured by the first execute guide the second
+        for(int i = 0; i < 2; i++)
+        {
+            w.execute();
+            EXPECT_EQ(w.registry().fetch<Node>("a")->to_int(),1000);
+            EXPECT_EQ(w.registry().fetch<Node>("z")->to_int(),2000);
+            w.registry().reset();
+        }
+    }
+
+    Node mem;
+    w.memory_info(mem);
+    mem.print();
+
+    EXPECT_EQ(mem["ordering"].as_string(),"memory");
+    // plan order holds both big outputs at once
+    EXPECT_TRUE(mem["plan_high_water_bytes"].to_int64() > 16000);
+    EXPECT_TRUE(mem["high_water_bytes"].to_int64() < 16000);
+    // all outputs are nodes, which are sized
+    EXPECT_EQ(mem["unknown_bytes_outputs"].to_int(),0);
+
+    Node info;
+    w.info(info);
+    EXPECT_TRUE(info.has_path("memory/high_water_bytes"));
+
+    // sizes are not measured w/o memory ordering or profiling
+    w.set_ordering("plan");
+    w.execute();
+    w.memory_info(mem);
+    EXPECT_FALSE(mem.has_child("high_water_bytes"));
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+class IntSrcFilter: public Filter
+{
+public:
+    IntSrcFilter()
+    : Filter()
+    {}
+        
+    virtual ~IntSrcFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "int_src";
+        i["output_port"] = "true";
+        i["port_names"]  = DataType::empty();
+    }
+
+    virtual void execute()
+    {
+        // no output_bytes() override, the size of the output is unknown
+        set_output<int>(new int(1000));
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, memory_unknown_bytes)
+{
+    Workspace::register_filter_type<IntSrcFilter>();
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<BigFilter>();
+
+    Workspace w;
+    w.graph().add_filter("int_src","i");
+    w.graph().add_filter("src","s");
+    w.graph().add_filter("big","b");
+    w.graph().connect("s","b","in");
+
+    w.set_ordering("memory");
+    w.execute();
+    EXPECT_EQ(*w.registry().fetch<int>("i"),1000);
+    w.registry().reset();
+
+    Node mem;
+    w.memory_info(mem);
+    mem.print();
+
+    // the int output is not counted in the high-water marks
+    EXPECT_EQ(mem["unknown_bytes_outputs"].to_int(),1);
+    EXPECT_TRUE(mem["high_water_bytes"].to_int64() >= 8000);
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+int merge_inc_exec_count = 0;
+
+//-----------------------------------------------------------------------------
+class MergeIncFilter: public Filter
+{
+public:
+    MergeIncFilter()
+    : Filter()
+    {}
+        
+    virtual ~MergeIncFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "merge_inc";
+        i["output_port"] = "true";
+        i["port_names"].append().set("in");
+        i["mergeable"]   = "true";
+        i["default_params"]["inc"].set((int)1);
+    }
+
+    virtual void execute()
+    {
+        merge_inc_exec_count++;
+
+        int inc  = params()["inc"].value();
+        Node *in = input<Node>("in");
+        Node *res = new Node();
+        res->set(in->to_int() + inc);
+        set_output<Node>(res);
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace, merge_common_filters)
+{
+    Workspace::register_filter_type<SrcFilter>();
+    Workspace::register_filter_type<MergeIncFilter>();
+    Workspace::register_filter_type<AddFilter>();
+
+    Workspace w;
+    EXPECT_FALSE(w.merge_filters());
+    w.set_merge_filters(true);
+
+    Node p_inc2;
+    p_inc2["inc"] = 2;
+
+    w.graph().add_filter("src","s");
+    // i2 duplicates i1, which makes j2 a duplicate of j1
+    w.graph().add_filter("merge_inc","i1");
+    w.graph().add_filter("merge_inc","i2");
+    w.graph().add_filter("merge_inc","i3",p_inc2);
+    w.graph().add_filter("merge_inc","j1");
+    w.graph().add_filter("merge_inc","j2");
+    // add is not mergeable
+    w.graph().add_filter("add","a1");
+    w.graph().add_filter("add","a2");
+    w.graph().add_filter("add","a3");
+
+    w.graph().connect("s","i1","in");
+    w.graph().connect("s","i2","in");
+    w.graph().connect("s","i3","in");
+    w.graph().connect("i1","j1","in");
+    w.graph().connect("i2","j2","in");
+    w.graph().connect("j1","a1","a");
+    w.graph().connect("j2","a1","b");
+    w.graph().connect("j1","a2","a");
+    w.graph().connect("i3","a2","b");
+    w.graph().connect("j1","a3","a");
+    w.graph().connect("j2","a3","b");
+
+    merge_inc_exec_count = 0;
+
+    for(int i = 0; i < 2; i++)
+    {
+        w.execute();
+        EXPECT_EQ(w.registry().fetch<Node>("a1")->to_int(),4);
+        EXPECT_EQ(w.registry().fetch<Node>("a2")->to_int(),4);
+        EXPECT_EQ(w.registry().fetch<Node>("a3")->to_int(),4);
+        w.registry().reset();
+    }
+
+    // i1, j1 and i3 run once per execute
+    EXPECT_EQ(merge_inc_exec_count,6);
+
+    EXPECT_FALSE(w.graph().has_filter("i2"));
+    EXPECT_FALSE(w.graph().has_filter("j2"));
+    EXPECT_TRUE(w.graph().has_filter("a3"));
+
+    Node merged;
+    w.merged_filters(merged);
+    merged.print();
+    EXPECT_EQ(merged.number_of_children(),2);
+    EXPECT_EQ(merged["i2"].as_string(),"i1");
+    EXPECT_EQ(merged["j2"].as_string(),"j1");
+
+    Node info;
+    w.info(info);
+    EXPECT_TRUE(info.has_path("merged_filters/j2"));
+
+    w.reset();
+    w.merged_filters(merged);
+    EXPECT_EQ(merged.number_of_children(),0);
+
+    Workspace::clear_supported_filter_types();
+}